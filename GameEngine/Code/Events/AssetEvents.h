@@ -0,0 +1,25 @@
+#pragma once
+
+#include <string>
+
+namespace Engine::Events
+{
+
+	struct ModelLoaded
+	{
+		std::string path;
+		// zero when the model was already resident and only instantiated
+		float loadTime;
+	};
+
+	struct SceneReloaded
+	{
+		std::string configPath;
+		float duration;
+		float longestFrame;
+		size_t loadedModels;
+		size_t reusedModels;
+		size_t evictedModels;
+	};
+
+}
\ No newline at end of file
@@ -1,6 +1,11 @@
 #pragma once
 
 #include <Windows.h>
+#include <string>
+#include <vector>
+
+#include "Utils/HardwareCounters.h"
+#include "Visual/RendererFrameStats.h"
 
 namespace Engine
 {
@@ -12,7 +17,37 @@ namespace Engine
 		float gpuMemoryUsage;
 		float cpuUsage;
 		float gpuUsage;
+		float processCpuUsage;
+		float mainThreadCpuUsage;
+		float workerThreadsCpuUsage;
 		float frameTimePercentile99;
+		float pacingErrorMedian;
+		float pacingErrorPercentile99;
+		float allocationsPerFrame;
+		float gpuFrameTime;
+		float gpuScenePassTime;
+		float gpuUIPassTime;
+		float gpuUploadTime;
+		Visual::RendererFrameStats rendererStats;
+	};
+
+	struct SystemTimingStats
+	{
+		std::string name;
+		float budget;
+		size_t budgetOverruns;
+		float meanTime;
+		float percentile99Time;
+		float maxTime;
+		size_t updatesCount;
+		Utils::HardwareCounters::Values counters;
+	};
+
+	struct SystemUpdateTime
+	{
+		std::string name;
+		float time;
+		float medianTime;
 	};
 }
 
@@ -35,5 +70,16 @@ namespace Engine::Events
 		std::string outputPath;
 	};
 
+	struct SystemsTimingUpdate
+	{
+		std::vector<SystemTimingStats> systems;
+	};
+
+	struct RendererFrameStatsUpdate
+	{
+		Visual::RendererFrameStats stats;
+		float presentTime;
+	};
+
 }
 
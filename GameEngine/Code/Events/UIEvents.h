@@ -19,5 +19,10 @@ namespace Engine::Events
 	{
 		std::string message;
 	};
+
+	struct FrameLimitUpdate
+	{
+		float targetFPS;
+	};
 }
 
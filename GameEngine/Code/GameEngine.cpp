@@ -7,12 +7,34 @@
 #include <chrono>
 #include <thread>
 #include <filesystem>
+#include <vector>
 
 #include "Managers/GameController.h"
 #include "Events/NativeInputEvents.h"
+#include "Utils/Profiler.h"
+#include "Utils/HardwareCounters.h"
+#include "Utils/TelemetryRing.h"
+
+static void printUsage()
+{
+    std::cout << "Usage: GameEngine [config.json [width height]] [options]\n"
+        << "  --record <path>         record the input of the run\n"
+        << "  --replay <path>         replay a recorded run\n"
+        << "  --fixed-dt <seconds>    fixed frame delta for headless runs and replays\n"
+        << "  --headless              run without a window\n"
+        << "  --frames <count>        headless run length in frames\n"
+        << "  --duration <seconds>    headless run length in simulated time\n"
+        << "  --summary <path>        headless or startup benchmark summary file\n"
+        << "  --startup-bench <count> measure the startup the given number of times and exit\n"
+        << "  --profile <path>        write a Chrome trace on exit, needs the Profile configuration\n"
+        << "  --hw-counters           per-frame CPU counters in the recorded stats, Linux only\n"
+        << "  --telemetry             publish live frame stats to shared memory\n"
+        << "  --help                  print this message" << std::endl;
+}
 
 int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine, int nCmdShow)
 {
+    Engine::GameController::get().getStartupTimeline().begin();
     AllocConsole();
 
     FILE* fpOut = nullptr;
@@ -33,41 +55,185 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
     LPWSTR cmdLine = GetCommandLineW();
     int argc;
     LPWSTR* argv = CommandLineToArgvW(cmdLine, &argc);
+    std::vector<std::string> positionalArgs;
+    std::string recordPath;
+    std::string replayPath;
+    float fixedDt = 0.0f;
+    bool headless = false;
+    Engine::GameController::HeadlessSettings headlessSettings;
+    size_t startupBenchIterations = 0;
+    std::string profilePath;
+    bool hardwareCounters = false;
+    bool telemetry = false;
+    bool help = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = Engine::Utils::wstringToString(argv[i]);
+        bool hasValue = i + 1 < argc;
+        if (arg == "--record" && hasValue)
+        {
+            recordPath = Engine::Utils::wstringToString(argv[++i]);
+        }
+        else if (arg == "--replay" && hasValue)
+        {
+            replayPath = Engine::Utils::wstringToString(argv[++i]);
+        }
+        else if (arg == "--fixed-dt" && hasValue)
+        {
+            fixedDt = std::stof(Engine::Utils::wstringToString(argv[++i]));
+        }
+        else if (arg == "--headless")
+        {
+            headless = true;
+        }
+        else if (arg == "--frames" && hasValue)
+        {
+            headlessSettings.frames = std::stoul(Engine::Utils::wstringToString(argv[++i]));
+        }
+        else if (arg == "--duration" && hasValue)
+        {
+            headlessSettings.duration = std::stof(Engine::Utils::wstringToString(argv[++i]));
+        }
+        else if (arg == "--startup-bench" && hasValue)
+        {
+            startupBenchIterations = std::stoul(Engine::Utils::wstringToString(argv[++i]));
+        }
+        else if (arg == "--summary" && hasValue)
+        {
+            headlessSettings.summaryPath = Engine::Utils::wstringToString(argv[++i]);
+        }
+        else if (arg == "--profile" && hasValue)
+        {
+            profilePath = Engine::Utils::wstringToString(argv[++i]);
+        }
+        else if (arg == "--hw-counters")
+        {
+            hardwareCounters = true;
+        }
+        else if (arg == "--telemetry")
+        {
+            telemetry = true;
+        }
+        else if (arg == "--help")
+        {
+            help = true;
+        }
+        else
+        {
+            positionalArgs.push_back(arg);
+        }
+    }
+
+    if (help)
+    {
+        printUsage();
+        return 0;
+    }
+
+#ifndef _PROFILE
+    // zones are compiled out, the trace would be empty
+    if (!profilePath.empty())
+    {
+        std::cout << "--profile needs a build with _PROFILE defined (the Profile configuration), no trace will be written" << std::endl;
+        profilePath.clear();
+    }
+#endif
+
+    if (!profilePath.empty())
+    {
+        Engine::Utils::Profiler::get().setEnabled(true);
+    }
+
+    // the counters follow the thread that opens them, which is the one running the frame loop
+    if (hardwareCounters)
+    {
+        Engine::Utils::HardwareCounters& counters = Engine::Utils::HardwareCounters::get();
+        bool opened = counters.open();
+        if (!counters.getError().empty())
+        {
+            std::cout << (opened ? "Some hardware counters are unavailable: " : "Hardware counters are unavailable: ") << counters.getError() << std::endl;
+        }
+    }
+
+    if (telemetry && !Engine::Utils::TelemetryRing::get().open())
+    {
+        std::cout << "Failed to open the telemetry ring " << Engine::Utils::TelemetryRing::k_defaultName << std::endl;
+    }
+
     std::string jsonPath = "../../Configs/config.json";
 
-    if (argc > 1)
+    if (positionalArgs.size() > 0)
     {
-        jsonPath = Engine::Utils::wstringToString(argv[1]);
+        jsonPath = positionalArgs[0];
     }
 
     int width = 1280;
     int height = 720;
-    if (argc > 3)
+    if (positionalArgs.size() > 2)
     {
-        width = std::stoi(Engine::Utils::wstringToString(argv[2]));
-        height = std::stoi(Engine::Utils::wstringToString(argv[3]));
+        width = std::stoi(positionalArgs[1]);
+        height = std::stoi(positionalArgs[2]);
     }
 
     Engine::Visual::Window window;
 
-
-    if (!window.initWindow(hInstance, width, height))
+    if (!headless)
     {
-        return 0;
+        auto windowStart = Engine::Utils::StartupTimeline::Clock::now();
+        if (!window.initWindow(hInstance, width, height))
+        {
+            return 0;
+        }
+
+        window.showWindow(nCmdShow);
+        Engine::GameController::get().getStartupTimeline().addPhase("Window", Engine::Utils::StartupTimeline::k_engineCategory, windowStart);
     }
 
-    window.showWindow(nCmdShow);
     window.SetOnKetStateChanged([](WPARAM param, bool state)
         {
-            Engine::GameController::get().getEventsManager().emit(Engine::Events::NativeKeyStateChanged{param, state});
+            Engine::GameController& gameController = Engine::GameController::get();
+            // live input would make the replayed run diverge from the recording
+            if (gameController.getReplayManager().isReplaying())
+            {
+                return;
+            }
+            gameController.getEventsManager().enqueue(Engine::Events::NativeKeyStateChanged{param, state});
         }
     );
 
     Engine::GameController& gameController = Engine::GameController::get();
 	gameController.setWindow(window);
 	gameController.setConfig(jsonPath);
+    if (headless)
+    {
+        headlessSettings.fixedDt = fixedDt;
+        gameController.setHeadless(headlessSettings);
+    }
 	gameController.init();
+
+    if (startupBenchIterations > 0)
+    {
+        gameController.runStartupBenchmark(startupBenchIterations, headlessSettings.summaryPath);
+        return 0;
+    }
+
+    if (!replayPath.empty())
+    {
+        gameController.getReplayManager().startReplay(replayPath, fixedDt);
+    }
+    else if (!recordPath.empty())
+    {
+        gameController.getReplayManager().startRecording(recordPath);
+    }
+
 	gameController.run();
+    gameController.getReplayManager().stop();
+
+    if (!profilePath.empty())
+    {
+        Engine::Utils::Profiler::get().saveChromeTrace(profilePath);
+    }
 
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,175 @@
+#include "AssetCache.h"
+
+#include "GameController.h"
+#include "Utils/DebugMacros.h"
+#include "Utils/Profiler.h"
+#include "Utils/AllocationTracker.h"
+
+namespace Engine
+{
+	//////////////////////////////////////////////////////////////////////////
+
+	void AssetCache::storeRenderer(const std::string& rendererName, std::unique_ptr<Visual::IRenderer> renderer, std::unique_ptr<Visual::UIController> uiController)
+	{
+		clear();
+
+		m_rendererName = rendererName;
+		m_renderer = std::move(renderer);
+		m_uiController = std::move(uiController);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	bool AssetCache::hasRenderer(const std::string& rendererName) const
+	{
+		return m_renderer != nullptr && m_rendererName == rendererName;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	std::unique_ptr<Visual::IRenderer> AssetCache::takeRenderer()
+	{
+		m_rendererName.clear();
+		return std::move(m_renderer);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	std::unique_ptr<Visual::UIController> AssetCache::takeUIController()
+	{
+		return std::move(m_uiController);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	std::shared_ptr<const Visual::ModelFile> AssetCache::loadModelFile(const std::string& path)
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_modelFilesMutex);
+			auto itr = m_modelFiles.find(path);
+			if (itr != m_modelFiles.end())
+			{
+				return itr->second;
+			}
+		}
+
+		// parsing runs outside the lock so a preloading thread doesn't stall the main thread
+		PROFILE_ZONE("AssetCache::loadModelFile");
+		ALLOCATION_SCOPE("Assets");
+		std::shared_ptr<const Visual::ModelFile> modelFile = Visual::ModelFile::parse(path);
+		ASSERT(modelFile, "Can't parse model: {}", path);
+		if (!modelFile)
+		{
+			return nullptr;
+		}
+
+		std::lock_guard<std::mutex> lock(m_modelFilesMutex);
+		return m_modelFiles.emplace(path, std::move(modelFile)).first->second;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	bool AssetCache::isModelResident(const std::string& path) const
+	{
+		return m_residentModels.contains(path);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void AssetCache::addResidentModel(const std::string& path)
+	{
+		m_residentModels.insert(path);
+		m_reloadStats.loadedModels++;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void AssetCache::addReusedModel()
+	{
+		m_reloadStats.reusedModels++;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	std::vector<std::string> AssetCache::evictUnusedModels(const std::unordered_set<std::string>& usedModels)
+	{
+		m_reloadStats = {};
+
+		std::vector<std::string> evictedModels;
+		for (auto itr = m_residentModels.begin(); itr != m_residentModels.end();)
+		{
+			if (usedModels.contains(*itr))
+			{
+				++itr;
+				continue;
+			}
+
+			evictedModels.push_back(*itr);
+			itr = m_residentModels.erase(itr);
+			m_reloadStats.evictedModels++;
+		}
+
+		// parsed models of the scene being loaded are kept even if the renderer has not uploaded them yet
+		std::lock_guard<std::mutex> lock(m_modelFilesMutex);
+		std::erase_if(m_modelFiles, [&usedModels](const auto& pair) { return !usedModels.contains(pair.first); });
+
+		return evictedModels;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void AssetCache::resetResidentModels()
+	{
+		m_residentModels.clear();
+		m_reloadStats = {};
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	const AssetCache::ReloadStats& AssetCache::getReloadStats() const
+	{
+		return m_reloadStats;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void AssetCache::setPendingModels(size_t pendingModels)
+	{
+		m_pendingModels = pendingModels;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	size_t AssetCache::getPendingModels() const
+	{
+		return m_pendingModels;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void AssetCache::clear()
+	{
+		if (m_renderer)
+		{
+			m_renderer->cleanUp();
+			m_renderer = nullptr;
+			m_residentModels.clear();
+		}
+
+#ifdef _SHOWUI
+		if (m_uiController && !GameController::get().isHeadless())
+		{
+			m_uiController->cleanUp();
+		}
+#endif
+
+		m_uiController = nullptr;
+		m_rendererName.clear();
+
+		// parsed models are dropped as well, otherwise a cold start after this would skip parsing
+		std::lock_guard<std::mutex> lock(m_modelFilesMutex);
+		m_modelFiles.clear();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+}
\ No newline at end of file
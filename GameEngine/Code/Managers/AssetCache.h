@@ -0,0 +1,56 @@
+#pragma once
+
+#include <string>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "Visual/IRenderer.h"
+#include "Visual/ModelFile.h"
+#include "Visual/UIController.h"
+
+namespace Engine
+{
+	// Keeps the parsed models and the renderer alive between scenes, so a scene reload only parses and
+	// uploads the models it does not share with the previous one. Uploads stay with the renderer, the cache
+	// only tracks which paths are resident in it. Parsed models are shared by path and can be loaded from any thread.
+	class AssetCache
+	{
+	public:
+		struct ReloadStats
+		{
+			size_t loadedModels;
+			size_t reusedModels;
+			size_t evictedModels;
+		};
+
+		void storeRenderer(const std::string& rendererName, std::unique_ptr<Visual::IRenderer> renderer, std::unique_ptr<Visual::UIController> uiController);
+		bool hasRenderer(const std::string& rendererName) const;
+		std::unique_ptr<Visual::IRenderer> takeRenderer();
+		std::unique_ptr<Visual::UIController> takeUIController();
+
+		std::shared_ptr<const Visual::ModelFile> loadModelFile(const std::string& path);
+		bool isModelResident(const std::string& path) const;
+		void addResidentModel(const std::string& path);
+		void addReusedModel();
+		std::vector<std::string> evictUnusedModels(const std::unordered_set<std::string>& usedModels);
+		void resetResidentModels();
+		const ReloadStats& getReloadStats() const;
+		void setPendingModels(size_t pendingModels);
+		size_t getPendingModels() const;
+
+		void clear();
+
+	private:
+		std::string m_rendererName;
+		std::unique_ptr<Visual::IRenderer> m_renderer;
+		std::unique_ptr<Visual::UIController> m_uiController;
+		std::unordered_set<std::string> m_residentModels;
+		std::unordered_map<std::string, std::shared_ptr<const Visual::ModelFile>> m_modelFiles;
+		mutable std::mutex m_modelFilesMutex;
+		ReloadStats m_reloadStats{};
+		size_t m_pendingModels = 0;
+	};
+}
\ No newline at end of file
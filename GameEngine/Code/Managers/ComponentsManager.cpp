@@ -43,6 +43,24 @@ namespace Engine
 			componentsSet->clear();
 		}
 	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void ComponentsManager::createSetsFrom(const ComponentsManager& other)
+	{
+		m_sparseSets.clear();
+		for (const auto& [name, componentsSet] : other.m_sparseSets)
+		{
+			m_sparseSets[name] = componentsSet->createEmpty();
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void ComponentsManager::swap(ComponentsManager& other)
+	{
+		m_sparseSets.swap(other.m_sparseSets);
+	}
 	
 	//////////////////////////////////////////////////////////////////////////
 }
\ No newline at end of file
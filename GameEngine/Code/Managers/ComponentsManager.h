@@ -49,6 +49,8 @@ namespace Engine
 		void createSet();
 
 		void clear();
+		void createSetsFrom(const ComponentsManager& other);
+		void swap(ComponentsManager& other);
 
 	private:
 		std::unordered_map<std::string, std::unique_ptr<Utils::SparseSetBase<EntityID>>> m_sparseSets;
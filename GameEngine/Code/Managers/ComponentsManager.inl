@@ -52,7 +52,7 @@ namespace Engine
 	const Utils::SparseSet<Component, EntityID>& ComponentsManager::getComponentSet() const
 	{
 		std::string name = Utils::getTypeName<Component>();
-		return *(std::static_pointer_cast<Utils::SparseSet<Component, EntityID>>(m_sparseSets.find(name)->second));
+		return *((const Utils::SparseSet<Component, EntityID>*)m_sparseSets.find(name)->second.get());
 	}
 
 	//////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,107 @@
+#include "EventsManager.h"
+
+#include "Utils/DebugMacros.h"
+#include "Utils/Profiler.h"
+#include "Utils/AllocationTracker.h"
+
+namespace Engine
+{
+    //////////////////////////////////////////////////////////////////////////
+
+    std::atomic<size_t> EventsManager::s_eventTypesCount = 0;
+
+    //////////////////////////////////////////////////////////////////////////
+
+    EventsManager::~EventsManager()
+    {
+        for (std::atomic<IPostedEventsQueue*>& postedEvents : m_postedEvents)
+        {
+            delete postedEvents.load(std::memory_order_acquire);
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+
+    void EventsManager::dispatchAll()
+    {
+        PROFILE_ZONE("EventsManager::dispatchAll");
+        ALLOCATION_SCOPE("Events");
+        dispatchPosted();
+
+        std::swap(m_queuedHolders, m_dispatchingHolders);
+        for (IListenerHolder* holder : m_dispatchingHolders)
+        {
+            holder->dispatchQueued();
+        }
+        m_dispatchingHolders.clear();
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+
+    void EventsManager::dispatchPosted()
+    {
+        size_t eventTypesCount = std::min(s_eventTypesCount.load(std::memory_order_acquire), k_maxEventTypes);
+        for (size_t i = 0; i < eventTypesCount; i++)
+        {
+            IPostedEventsQueue* postedEvents = m_postedEvents[i].load(std::memory_order_acquire);
+            if (postedEvents != nullptr)
+            {
+                postedEvents->dispatch(*this);
+            }
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+
+    size_t EventsManager::getPostedEventsCount() const
+    {
+        size_t count = 0;
+        for (const std::atomic<IPostedEventsQueue*>& postedEvents : m_postedEvents)
+        {
+            IPostedEventsQueue* queue = postedEvents.load(std::memory_order_acquire);
+            if (queue != nullptr)
+            {
+                count += queue->postedCount.load(std::memory_order_relaxed);
+            }
+        }
+        return count;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+
+    size_t EventsManager::getDroppedEventsCount() const
+    {
+        size_t count = m_rejectedPostsCount.load(std::memory_order_relaxed);
+        for (const std::atomic<IPostedEventsQueue*>& postedEvents : m_postedEvents)
+        {
+            IPostedEventsQueue* queue = postedEvents.load(std::memory_order_acquire);
+            if (queue != nullptr)
+            {
+                count += queue->droppedCount.load(std::memory_order_relaxed);
+            }
+        }
+        return count;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+
+    void EventsManager::onPostedEventTypeRejected(size_t index)
+    {
+        // reported once, posts of the rejected types are counted as dropped afterwards
+        if (m_rejectedPostsCount.fetch_add(1, std::memory_order_relaxed) == 0)
+        {
+            LOG_INFO("Event type {} exceeds k_maxEventTypes ({}), its posted events are dropped", index, k_maxEventTypes);
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+
+    size_t EventsManager::allocateEventTypeIndex()
+    {
+        size_t index = s_eventTypesCount.fetch_add(1, std::memory_order_relaxed);
+        ASSERT(index < k_maxEventTypes, "Too many event types, increase k_maxEventTypes");
+        return index;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+}
\ No newline at end of file
@@ -1,8 +1,14 @@
 #pragma once
 
-#include <typeindex>
-#include <functional>
 #include <memory>
+#include <algorithm>
+#include <atomic>
+#include <array>
+#include <span>
+#include <vector>
+
+#include "Utils/MPSCQueue.h"
+#include "Utils/Delegate.h"
 
 namespace Engine
 {
@@ -11,38 +17,106 @@ namespace Engine
     class EventsManager 
     {
     public:
+        EventsManager() = default;
+        EventsManager(const EventsManager&) = delete;
+        EventsManager& operator=(const EventsManager&) = delete;
+        ~EventsManager();
+
+        template <typename EventType>
+        using EventCallback = Utils::Delegate<void(const EventType&)>;
 
         template <typename EventType>
-        using EventCallback = std::function<void(const EventType&)>;
+        using BatchEventCallback = Utils::Delegate<void(std::span<const EventType>)>;
 
         template <typename EventType>
         EventListenerID subscribe(EventCallback<EventType> callback);
 
+        template <typename EventType>
+        EventListenerID subscribeBatch(BatchEventCallback<EventType> callback);
+
         template <typename EventType>
 		void unsubscribe(EventListenerID id);
 
         template <typename EventType>
         void emit(const EventType& event) const;
 
+        // queued events are delivered by dispatchAll, batch listeners get each type's events in one call
+        template <typename EventType>
+        void enqueue(const EventType& event);
+
+        // can be called from any thread, events are delivered by dispatchAll on the main thread
+        template <typename EventType>
+        bool post(EventType event);
+
+        void dispatchAll();
+        size_t getPostedEventsCount() const;
+        size_t getDroppedEventsCount() const;
+
     private:
         struct IListenerHolder
         {
             virtual ~IListenerHolder() = default;
+            virtual void dispatchQueued() = 0;
+
+            bool hasQueuedEvents = false;
         };
 
         template <typename EventType>
         struct ListenerHolder : IListenerHolder
         {
+            void dispatchQueued() override;
+
             std::vector<std::pair<EventListenerID, EventCallback<EventType>>> listeners;
+            std::vector<std::pair<EventListenerID, BatchEventCallback<EventType>>> batchListeners;
+            std::vector<EventType> queuedEvents;
+            std::vector<EventType> dispatchingEvents;
 			EventListenerID nextID = 0;
         };
 
+        struct IPostedEventsQueue
+        {
+            virtual ~IPostedEventsQueue() = default;
+            virtual void dispatch(EventsManager& manager) = 0;
+
+            std::atomic<size_t> postedCount = 0;
+            std::atomic<size_t> droppedCount = 0;
+        };
+
+        template <typename EventType>
+        struct PostedEventsQueue : IPostedEventsQueue
+        {
+            PostedEventsQueue();
+            void dispatch(EventsManager& manager) override;
+
+            Utils::MPSCQueue<EventType> queue;
+        };
+
     private:
+        void dispatchPosted();
+
         template <typename EventType>
         ListenerHolder<EventType>& getListenersHolder() const;
 
+        // nullptr once the event types outnumber k_maxEventTypes
+        template <typename EventType>
+        PostedEventsQueue<EventType>* getPostedEventsQueue();
+        void onPostedEventTypeRejected(size_t index);
+
+        template <typename EventType>
+        static size_t getEventTypeIndex();
+        static size_t allocateEventTypeIndex();
+
     private:
-        mutable std::unordered_map<std::type_index, std::unique_ptr<IListenerHolder>> m_eventsListeners;
+        static constexpr size_t k_maxEventTypes = 64;
+        static constexpr size_t k_postedEventsCapacity = 1024;
+
+        static std::atomic<size_t> s_eventTypesCount;
+
+        mutable std::vector<std::unique_ptr<IListenerHolder>> m_eventsListeners;
+        std::array<std::atomic<IPostedEventsQueue*>, k_maxEventTypes> m_postedEvents{};
+        std::atomic<size_t> m_rejectedPostsCount = 0;
+        std::vector<IListenerHolder*> m_queuedHolders;
+        std::vector<IListenerHolder*> m_dispatchingHolders;
 
     };
 }
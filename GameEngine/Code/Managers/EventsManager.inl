@@ -17,12 +17,26 @@ namespace Engine
 
     //////////////////////////////////////////////////////////////////////////
 
+    template <typename EventType>
+    EventListenerID EventsManager::subscribeBatch(BatchEventCallback<EventType> callback)
+    {
+        ListenerHolder<EventType>& listenerHolder = getListenersHolder<EventType>();
+        EventListenerID id = listenerHolder.nextID++;
+        listenerHolder.batchListeners.emplace_back(id, std::move(callback));
+        return id;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+
     template<typename EventType>
     void EventsManager::unsubscribe(EventListenerID id)
     {
         ListenerHolder<EventType>& listenerHolder = getListenersHolder<EventType>();
         auto itr = std::remove_if(listenerHolder.listeners.begin(), listenerHolder.listeners.end(), [id](const auto& listener) { return listener.first == id; });
 		listenerHolder.listeners.erase(itr, listenerHolder.listeners.end());
+
+        auto batchItr = std::remove_if(listenerHolder.batchListeners.begin(), listenerHolder.batchListeners.end(), [id](const auto& listener) { return listener.first == id; });
+        listenerHolder.batchListeners.erase(batchItr, listenerHolder.batchListeners.end());
     }
 
     //////////////////////////////////////////////////////////////////////////
@@ -35,6 +49,132 @@ namespace Engine
         {
             listener.second(event);
         }
+
+        for (std::pair<EventListenerID, BatchEventCallback<EventType>>& listener : listenerHolder.batchListeners)
+        {
+            listener.second(std::span<const EventType>(&event, 1));
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+
+    template <typename EventType>
+    void EventsManager::enqueue(const EventType& event)
+    {
+        ListenerHolder<EventType>& listenerHolder = getListenersHolder<EventType>();
+        listenerHolder.queuedEvents.push_back(event);
+        if (!listenerHolder.hasQueuedEvents)
+        {
+            listenerHolder.hasQueuedEvents = true;
+            m_queuedHolders.push_back(&listenerHolder);
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+
+    template <typename EventType>
+    void EventsManager::ListenerHolder<EventType>::dispatchQueued()
+    {
+        // events enqueued by the listeners below are kept for the next dispatch
+        std::swap(queuedEvents, dispatchingEvents);
+        hasQueuedEvents = false;
+
+        std::span<const EventType> events(dispatchingEvents);
+        for (std::pair<EventListenerID, BatchEventCallback<EventType>>& listener : batchListeners)
+        {
+            listener.second(events);
+        }
+
+        for (std::pair<EventListenerID, EventCallback<EventType>>& listener : listeners)
+        {
+            for (const EventType& event : events)
+            {
+                listener.second(event);
+            }
+        }
+
+        dispatchingEvents.clear();
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+
+    template <typename EventType>
+    bool EventsManager::post(EventType event)
+    {
+        PostedEventsQueue<EventType>* postedEvents = getPostedEventsQueue<EventType>();
+        if (postedEvents == nullptr)
+        {
+            return false;
+        }
+
+        if (!postedEvents->queue.push(std::move(event)))
+        {
+            postedEvents->droppedCount.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        postedEvents->postedCount.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+
+    template <typename EventType>
+    EventsManager::PostedEventsQueue<EventType>::PostedEventsQueue() : queue(k_postedEventsCapacity)
+    {
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+
+    template <typename EventType>
+    void EventsManager::PostedEventsQueue<EventType>::dispatch(EventsManager& manager)
+    {
+        // bounded by capacity, so producers posting while the queue is drained can't stall the frame
+        EventType event;
+        for (size_t i = 0; i < queue.capacity() && queue.pop(event); i++)
+        {
+            manager.enqueue(event);
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+
+    template <typename EventType>
+    EventsManager::PostedEventsQueue<EventType>* EventsManager::getPostedEventsQueue()
+    {
+        // the ASSERT on the index is compiled out in release, the post is dropped instead of writing past the slots
+        size_t index = getEventTypeIndex<EventType>();
+        if (index >= k_maxEventTypes)
+        {
+            onPostedEventTypeRejected(index);
+            return nullptr;
+        }
+        std::atomic<IPostedEventsQueue*>& slot = m_postedEvents[index];
+
+        IPostedEventsQueue* postedEvents = slot.load(std::memory_order_acquire);
+        if (postedEvents == nullptr)
+        {
+            IPostedEventsQueue* newPostedEvents = new PostedEventsQueue<EventType>();
+            if (slot.compare_exchange_strong(postedEvents, newPostedEvents, std::memory_order_acq_rel))
+            {
+                postedEvents = newPostedEvents;
+            }
+            else
+            {
+                delete newPostedEvents;
+            }
+        }
+
+        return static_cast<PostedEventsQueue<EventType>*>(postedEvents);
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+
+    template <typename EventType>
+    size_t EventsManager::getEventTypeIndex()
+    {
+        static const size_t index = allocateEventTypeIndex();
+        return index;
     }
 
     //////////////////////////////////////////////////////////////////////////
@@ -42,13 +182,18 @@ namespace Engine
     template <typename EventType>
     EventsManager::ListenerHolder<EventType>& EventsManager::getListenersHolder() const
     {
-        auto type = std::type_index(typeid(EventType));
-        auto it = m_eventsListeners.find(type);
-        if (it == m_eventsListeners.end())
+        size_t index = getEventTypeIndex<EventType>();
+        if (index >= m_eventsListeners.size())
+        {
+            m_eventsListeners.resize(index + 1);
+        }
+
+        std::unique_ptr<IListenerHolder>& listenerHolder = m_eventsListeners[index];
+        if (!listenerHolder)
         {
-            it = m_eventsListeners.emplace(type, std::make_unique<ListenerHolder<EventType>>()).first;
+            listenerHolder = std::make_unique<ListenerHolder<EventType>>();
         }
-        return *static_cast<ListenerHolder<EventType>*>(it->second.get());
+        return *static_cast<ListenerHolder<EventType>*>(listenerHolder.get());
     }
 
     //////////////////////////////////////////////////////////////////////////
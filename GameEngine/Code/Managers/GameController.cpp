@@ -1,8 +1,15 @@
 #include "GameController.h"
 
+#include <fstream>
+#include <iostream>
+
 #include "Utils/DebugMacros.h"
 #include "Events/NativeInputEvents.h"
 #include "Events/UIEvents.h"
+#include "Events/AssetEvents.h"
+#include "Components/Model.h"
+#include "Utils/Profiler.h"
+#include "Utils/AllocationTracker.h"
 
 
 namespace Engine
@@ -40,8 +47,10 @@ namespace Engine
 
 	void GameController::setConfig(const std::string& configPath)
 	{
+		auto phaseStart = Utils::StartupTimeline::Clock::now();
 		m_configPath = std::filesystem::absolute(configPath).string();
 		m_config = Utils::Parser::readJson(configPath);
+		m_startupTimeline.addPhase("Config parsing", Utils::StartupTimeline::k_engineCategory, phaseStart);
 	}
 
 	//////////////////////////////////////////////////////////////////////////
@@ -62,11 +71,38 @@ namespace Engine
 
 	//////////////////////////////////////////////////////////////////////////
 
+	void GameController::setHeadless(const HeadlessSettings& settings)
+	{
+		m_headless = true;
+		m_headlessSettings = settings;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	bool GameController::isHeadless() const
+	{
+		return m_headless;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
 	void GameController::init()
 	{
+		initSimulation();
+		initFrameLimiter();
+		initSceneLoading();
+
+		auto phaseStart = Utils::StartupTimeline::Clock::now();
 		initPrefabs();
+		m_startupTimeline.addPhase("Prefabs", Utils::StartupTimeline::k_engineCategory, phaseStart);
+
+		phaseStart = Utils::StartupTimeline::Clock::now();
 		initEntities();
+		m_startupTimeline.addPhase("Entities", Utils::StartupTimeline::k_engineCategory, phaseStart);
+
+		phaseStart = Utils::StartupTimeline::Clock::now();
 		initSystems();
+		m_startupTimeline.addPhase("Systems creation", Utils::StartupTimeline::k_engineCategory, phaseStart);
 	}
 
 	//////////////////////////////////////////////////////////////////////////
@@ -81,54 +117,237 @@ namespace Engine
 			}
 		);
 
-		bool configFileChangeRequested = false;
-		std::string newConfigPath = m_configPath;
+		SceneSwitchState sceneSwitch;
+		sceneSwitch.newConfigPath = m_configPath;
 		EventListenerID configFileChangeListenerId = m_eventsManager.subscribe<Engine::Events::ConfigFileUpdate>(
-			[&configFileChangeRequested, &newConfigPath, this](const Engine::Events::ConfigFileUpdate& i_update)
+			[&sceneSwitch, this](const Engine::Events::ConfigFileUpdate& i_update)
+			{
+				if (i_update.configPath == m_configPath || sceneSwitch.inProgress)
+				{
+					return;
+				}
+
+				sceneSwitch.inProgress = true;
+				sceneSwitch.longestFrame = 0.0f;
+				sceneSwitch.start = std::chrono::high_resolution_clock::now();
+
+				if (m_backgroundSceneLoading)
+				{
+					startScenePreload(i_update.configPath);
+					return;
+				}
+
+				sceneSwitch.newConfigPath = i_update.configPath;
+				sceneSwitch.configChangeRequested = true;
+			}
+		);
+
+		EventListenerID frameLimitListenerId = m_eventsManager.subscribe<Engine::Events::FrameLimitUpdate>(
+			[this](const Engine::Events::FrameLimitUpdate& i_update)
 			{
-				newConfigPath = i_update.configPath;
-				configFileChangeRequested = newConfigPath != m_configPath;
+				m_frameLimiter.setTargetFPS(i_update.targetFPS);
 			}
 		);
 
+		size_t framesCount = 0;
+		double simulatedTime = 0.0;
+		m_headlessFrameTimes.clear();
+		auto runStart = std::chrono::high_resolution_clock::now();
+		auto lastFrameEnd = runStart;
+
 		while (true)
 		{
 			float dt = 0;
 			auto start = std::chrono::high_resolution_clock::now();
-			while (!nativeExitRequested && !configFileChangeRequested)
+			while (!nativeExitRequested && !sceneSwitch.configChangeRequested)
 			{
-				bool needToExit = m_window.update();
-				if (needToExit)
+				PROFILE_ZONE("Frame");
+				Utils::AllocationTracker::get().markFrame();
+				auto frameStart = std::chrono::high_resolution_clock::now();
+				if (!m_headless)
+				{
+					bool needToExit = m_window.update();
+					if (needToExit)
+					{
+						break;
+					}
+				}
+
+				// the preloaded scene replaces the current one between two frames
+				if (m_scenePreloaded)
 				{
-					break;
+					swapPreloadedScene();
+					sceneSwitch.reloadPending = true;
 				}
 
+				m_replayManager.beginFrame();
+				m_eventsManager.dispatchAll();
+
+				auto systemsStart = Utils::StartupTimeline::Clock::now();
+				bool firstFrame = !m_startupTimeline.hasFirstFrame();
 				m_systemsManager.processAddedSystems();
 				m_systemsManager.processRemovedSystems();
+				if (firstFrame)
+				{
+					m_startupTimeline.addPhase("Systems start", Utils::StartupTimeline::k_engineCategory, systemsStart);
+				}
 
 				auto end = std::chrono::high_resolution_clock::now();
 				std::chrono::duration<float> elapsed = end - start;
 				dt = elapsed.count();
+				if (m_replayManager.isReplaying())
+				{
+					dt = m_replayManager.getFrameDt();
+				}
+				else if (m_headless && m_headlessSettings.fixedDt > 0.0f)
+				{
+					dt = m_headlessSettings.fixedDt;
+				}
 
 				start = std::chrono::high_resolution_clock::now();
-				m_systemsManager.update(dt);
+				m_tasksManager.update(dt);
+				if (m_fixedTimestep)
+				{
+					updateSimulation(dt);
+					m_systemsManager.update(Systems::UpdateGroup::Frame, dt);
+				}
+				else
+				{
+					m_systemsManager.update(dt);
+				}
+
+				m_startupTimeline.markFirstFrame();
+				m_replayManager.endFrame(dt);
+
+				if (m_headless)
+				{
+					std::chrono::duration<float> frameTime = std::chrono::high_resolution_clock::now() - frameStart;
+					m_headlessFrameTimes.add(frameTime.count());
+					framesCount++;
+					simulatedTime += dt;
+					if (isHeadlessRunFinished(framesCount, simulatedTime))
+					{
+						break;
+					}
+				}
+
+				m_frameLimiter.wait();
+
+				auto frameEnd = std::chrono::high_resolution_clock::now();
+				std::chrono::duration<float> frameInterval = frameEnd - lastFrameEnd;
+				lastFrameEnd = frameEnd;
+				if (!sceneSwitch.inProgress)
+				{
+					continue;
+				}
+
+				sceneSwitch.longestFrame = std::max(sceneSwitch.longestFrame, frameInterval.count());
+
+				// the switch ends once every model of the new scene is uploaded
+				if (sceneSwitch.reloadPending && m_assetCache.getPendingModels() == 0)
+				{
+					sceneSwitch.inProgress = false;
+					sceneSwitch.reloadPending = false;
+					std::chrono::duration<float> switchTime = frameEnd - sceneSwitch.start;
+					const AssetCache::ReloadStats& reloadStats = m_assetCache.getReloadStats();
+					m_eventsManager.emit(Events::SceneReloaded{
+						m_configPath, switchTime.count(), sceneSwitch.longestFrame,
+						reloadStats.loadedModels, reloadStats.reusedModels, reloadStats.evictedModels });
+				}
 			}
 
+			waitForScenePreload();
 			m_systemsManager.stop();
 			clear();
 
-			if (!configFileChangeRequested)
+			if (!sceneSwitch.configChangeRequested || isHeadlessRunFinished(framesCount, simulatedTime))
 			{
 				break;
 			}
 
-			setConfig(newConfigPath);
+			m_startupTimeline.begin();
+			setConfig(sceneSwitch.newConfigPath);
 			init();
-			configFileChangeRequested = false;
+			m_assetCache.setPendingModels(0);
+			sceneSwitch.configChangeRequested = false;
+			sceneSwitch.reloadPending = true;
 		}
 
+		m_assetCache.clear();
+		m_preloadedScene = nullptr;
+
 		m_eventsManager.unsubscribe<Engine::Events::NativeExitRequested>(exitRequestedListenerId);
 		m_eventsManager.unsubscribe<Engine::Events::ConfigFileUpdate>(configFileChangeListenerId);
+		m_eventsManager.unsubscribe<Engine::Events::FrameLimitUpdate>(frameLimitListenerId);
+
+		if (m_headless)
+		{
+			std::chrono::duration<double> wallTime = std::chrono::high_resolution_clock::now() - runStart;
+			saveHeadlessSummary(simulatedTime, wallTime.count());
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void GameController::runStartupBenchmark(size_t iterations, const std::string& outputPath)
+	{
+		nlohmann::json coldRuns = nlohmann::json::array();
+		nlohmann::json warmRuns = nlohmann::json::array();
+		std::vector<float> coldTimes;
+		std::vector<float> warmTimes;
+
+		// the first half starts with an empty asset cache, the second half reuses it
+		for (size_t i = 0; i < 2 * iterations; i++)
+		{
+			bool cold = i < iterations;
+			if (i > 0)
+			{
+				m_startupTimeline.begin();
+				setConfig(m_configPath);
+				init();
+			}
+
+			runUntilFirstFrame();
+
+			(cold ? coldRuns : warmRuns).push_back(m_startupTimeline.toJson());
+			(cold ? coldTimes : warmTimes).push_back(m_startupTimeline.getTimeToFirstFrame());
+
+			m_systemsManager.stop();
+			clear();
+
+			if (i + 1 < iterations)
+			{
+				m_assetCache.clear();
+			}
+		}
+
+		m_assetCache.clear();
+
+		nlohmann::json summary;
+		summary["config"] = m_configPath;
+		summary["iterations"] = iterations;
+		summary["cold"] = coldRuns;
+		summary["warm"] = warmRuns;
+
+		std::sort(coldTimes.begin(), coldTimes.end());
+		std::sort(warmTimes.begin(), warmTimes.end());
+		summary["coldMedianTimeToFirstFrame"] = coldTimes.empty() ? 0.0f : coldTimes[coldTimes.size() / 2];
+		summary["warmMedianTimeToFirstFrame"] = warmTimes.empty() ? 0.0f : warmTimes[warmTimes.size() / 2];
+
+		if (outputPath.empty())
+		{
+			std::cout << summary.dump(4) << std::endl;
+			return;
+		}
+
+		std::ofstream outFile(outputPath);
+		ASSERT(outFile.is_open(), "Failed to open startup benchmark file {}", outputPath);
+		if (!outFile.is_open())
+		{
+			return;
+		}
+
+		outFile << summary.dump(4);
 	}
 
 	//////////////////////////////////////////////////////////////////////////
@@ -136,9 +355,14 @@ namespace Engine
 	void GameController::clear()
 	{
 		m_prefabs.clear();
+		m_tasksManager.clear();
 		m_systemsManager.clear();
 		m_componentsManager.clear();
 		m_entitiesManager.clear();
+		m_previousTransformIds.clear();
+		m_previousTransforms.clear();
+		m_accumulator = 0.0f;
+		m_interpolationAlpha = 1.0f;
 	}
 
 	//////////////////////////////////////////////////////////////////////////
@@ -171,6 +395,27 @@ namespace Engine
 
 	//////////////////////////////////////////////////////////////////////////
 
+	TasksManager& GameController::getTasksManager()
+	{
+		return m_tasksManager;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	ReplayManager& GameController::getReplayManager()
+	{
+		return m_replayManager;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	AssetCache& GameController::getAssetCache()
+	{
+		return m_assetCache;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
 	const EventsManager& GameController::getEventsManager() const
 	{
 		return m_eventsManager;
@@ -197,6 +442,27 @@ namespace Engine
 
 	//////////////////////////////////////////////////////////////////////////
 
+	const TasksManager& GameController::getTasksManager() const
+	{
+		return m_tasksManager;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	const ReplayManager& GameController::getReplayManager() const
+	{
+		return m_replayManager;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	const AssetCache& GameController::getAssetCache() const
+	{
+		return m_assetCache;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
 	ComponentsFactory& GameController::getComponentsFactory()
 	{
 		return m_componentsFactory;
@@ -225,6 +491,34 @@ namespace Engine
 
 	//////////////////////////////////////////////////////////////////////////
 
+	Utils::FrameLimiter& GameController::getFrameLimiter()
+	{
+		return m_frameLimiter;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	const Utils::FrameLimiter& GameController::getFrameLimiter() const
+	{
+		return m_frameLimiter;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	Utils::StartupTimeline& GameController::getStartupTimeline()
+	{
+		return m_startupTimeline;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	const Utils::StartupTimeline& GameController::getStartupTimeline() const
+	{
+		return m_startupTimeline;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
 	EntityID GameController::createPrefab(const std::string& prefabName)
 	{
 		Engine::EntityID id = m_entitiesManager.createEntity();
@@ -253,15 +547,46 @@ namespace Engine
 
 	//////////////////////////////////////////////////////////////////////////
 
-	void GameController::createEntity(const nlohmann::json& entityJson)
+	bool GameController::isFixedTimestep() const
 	{
-		Engine::EntityID id = m_entitiesManager.createEntity();
+		return m_fixedTimestep;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	float GameController::getInterpolationAlpha() const
+	{
+		return m_interpolationAlpha;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	const Components::Transform* GameController::getPreviousTransform(EntityID id) const
+	{
+		int index = m_componentsManager.getComponentSet<Components::Transform>().getIndex(id);
+		if (index < 0 || static_cast<size_t>(index) >= m_previousTransformIds.size() || m_previousTransformIds[index] != id)
+		{
+			return nullptr;
+		}
+
+		return &m_previousTransforms[index];
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void GameController::createEntity(
+		ComponentsManager& componentsManager,
+		EntitiesManager& entitiesManager,
+		const std::unordered_map<std::string, nlohmann::json>& prefabs,
+		const nlohmann::json& entityJson)
+	{
+		Engine::EntityID id = entitiesManager.createEntity();
 
 		if (entityJson.contains(k_componentsField))
 		{
 			for (const nlohmann::json& compJson : entityJson[k_componentsField])
 			{
-				m_componentsFactory.createComponentFromJson(m_componentsManager, id, compJson);
+				m_componentsFactory.createComponentFromJson(componentsManager, id, compJson);
 			}
 		}
 
@@ -271,8 +596,8 @@ namespace Engine
 		}
 
 		std::string prefabName = entityJson[k_prefabField].get<std::string>();
-		const auto& prefabItr = m_prefabs.find(prefabName);
-		if (prefabItr == m_prefabs.end())
+		const auto& prefabItr = prefabs.find(prefabName);
+		if (prefabItr == prefabs.end())
 		{
 			return;
 		}
@@ -285,16 +610,21 @@ namespace Engine
 
 		for (const nlohmann::json& compJson : prefabJson[k_componentsField])
 		{
-			m_componentsFactory.createComponentFromJson(m_componentsManager, id, compJson);
+			m_componentsFactory.createComponentFromJson(componentsManager, id, compJson);
 		}		
 		
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 
-	void GameController::initPrefabs()
+	void GameController::loadPrefabs(const nlohmann::json& config, std::unordered_map<std::string, nlohmann::json>& prefabs) const
 	{
-		for (const nlohmann::json& prefabJson : m_config[k_prefabsField])
+		if (!config.contains(k_prefabsField))
+		{
+			return;
+		}
+
+		for (const nlohmann::json& prefabJson : config[k_prefabsField])
 		{
 			if (!prefabJson.contains(k_nameField))
 			{
@@ -302,17 +632,24 @@ namespace Engine
 			}
 
 			std::string prefabName = prefabJson[k_nameField].get<std::string>();
-			m_prefabs[prefabName] = prefabJson;
+			prefabs[prefabName] = prefabJson;
 		}
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 
+	void GameController::initPrefabs()
+	{
+		loadPrefabs(m_config, m_prefabs);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
 	void GameController::initEntities()
 	{
 		for (const nlohmann::json& entityJson : m_config[k_entitiesField])
 		{
-			createEntity(entityJson);
+			createEntity(m_componentsManager, m_entitiesManager, m_prefabs, entityJson);
 		}
 	}
 
@@ -328,4 +665,272 @@ namespace Engine
 
 	//////////////////////////////////////////////////////////////////////////
 
+	void GameController::initSimulation()
+	{
+		m_fixedTimestep = false;
+		m_fixedDt = 1.0f / 60.0f;
+		m_maxStepsPerFrame = 5;
+
+		if (!m_config.contains(k_simulationField))
+		{
+			return;
+		}
+
+		const nlohmann::json& simulationJson = m_config[k_simulationField];
+		if (simulationJson.contains(k_fixedTimestepField))
+		{
+			m_fixedTimestep = simulationJson[k_fixedTimestepField].get<bool>();
+		}
+
+		if (simulationJson.contains(k_tickRateField))
+		{
+			float tickRate = simulationJson[k_tickRateField].get<float>();
+			ASSERT(tickRate > 0.0f, "{} must be positive", k_tickRateField);
+			if (tickRate > 0.0f)
+			{
+				m_fixedDt = 1.0f / tickRate;
+			}
+		}
+
+		if (simulationJson.contains(k_maxStepsPerFrameField))
+		{
+			m_maxStepsPerFrame = std::max<size_t>(simulationJson[k_maxStepsPerFrameField].get<size_t>(), 1);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void GameController::initFrameLimiter()
+	{
+		// a scene reload keeps the limit chosen in the UI unless the new config sets its own
+		float targetFPS = m_frameLimiter.getTargetFPS();
+		if (m_config.contains(k_frameLimiterField))
+		{
+			const nlohmann::json& frameLimiterJson = m_config[k_frameLimiterField];
+			if (frameLimiterJson.contains(k_targetFPSField))
+			{
+				targetFPS = frameLimiterJson[k_targetFPSField].get<float>();
+			}
+		}
+
+		// headless runs measure engine cost, so frames are never paced
+		if (m_headless)
+		{
+			targetFPS = 0.0f;
+		}
+
+		m_frameLimiter.setTargetFPS(targetFPS);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void GameController::initSceneLoading()
+	{
+		m_backgroundSceneLoading = false;
+		if (!m_config.contains(k_sceneLoadingField))
+		{
+			return;
+		}
+
+		const nlohmann::json& sceneLoadingJson = m_config[k_sceneLoadingField];
+		if (sceneLoadingJson.contains(k_backgroundField))
+		{
+			m_backgroundSceneLoading = sceneLoadingJson[k_backgroundField].get<bool>();
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void GameController::startScenePreload(const std::string& configPath)
+	{
+		ASSERT(!m_preloadThread.joinable(), "Scene preload is already in progress");
+		if (m_preloadThread.joinable())
+		{
+			return;
+		}
+
+		m_preloadedScene = std::make_unique<SceneData>();
+		m_preloadedScene->configPath = std::filesystem::absolute(configPath).string();
+		m_preloadedScene->componentsManager.createSetsFrom(m_componentsManager);
+		m_scenePreloaded = false;
+		m_preloadThread = std::thread(&GameController::preloadScene, this);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void GameController::preloadScene()
+	{
+		PROFILE_ZONE("GameController::preloadScene");
+		ALLOCATION_SCOPE("ScenePreload");
+		SceneData& scene = *m_preloadedScene;
+		scene.config = Utils::Parser::readJson(scene.configPath);
+		loadPrefabs(scene.config, scene.prefabs);
+
+		if (scene.config.contains(k_entitiesField))
+		{
+			for (const nlohmann::json& entityJson : scene.config[k_entitiesField])
+			{
+				createEntity(scene.componentsManager, scene.entitiesManager, scene.prefabs, entityJson);
+			}
+		}
+
+		// the models are parsed into the asset cache here, the main thread only uploads them
+		std::filesystem::path configDir = std::filesystem::path(scene.configPath).parent_path();
+		for (const Components::Model& model : scene.componentsManager.getComponentSet<Components::Model>().getElements())
+		{
+			std::filesystem::path modelPath = configDir / model.path;
+			if (std::filesystem::exists(modelPath))
+			{
+				m_assetCache.loadModelFile(modelPath.string());
+			}
+		}
+
+		m_scenePreloaded = true;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void GameController::swapPreloadedScene()
+	{
+		waitForScenePreload();
+
+		m_systemsManager.stop();
+		clear();
+
+		m_startupTimeline.begin();
+		m_configPath = m_preloadedScene->configPath;
+		m_config = std::move(m_preloadedScene->config);
+		m_prefabs = std::move(m_preloadedScene->prefabs);
+		m_componentsManager.swap(m_preloadedScene->componentsManager);
+		m_entitiesManager = std::move(m_preloadedScene->entitiesManager);
+		m_preloadedScene = nullptr;
+
+		initSimulation();
+		initFrameLimiter();
+		initSceneLoading();
+		initSystems();
+		m_assetCache.setPendingModels(0);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void GameController::waitForScenePreload()
+	{
+		if (m_preloadThread.joinable())
+		{
+			m_preloadThread.join();
+		}
+		m_scenePreloaded = false;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void GameController::runUntilFirstFrame()
+	{
+		auto start = std::chrono::high_resolution_clock::now();
+		if (!m_headless && m_window.update())
+		{
+			return;
+		}
+
+		m_eventsManager.dispatchAll();
+
+		auto systemsStart = Utils::StartupTimeline::Clock::now();
+		m_systemsManager.processAddedSystems();
+		m_systemsManager.processRemovedSystems();
+		m_startupTimeline.addPhase("Systems start", Utils::StartupTimeline::k_engineCategory, systemsStart);
+
+		std::chrono::duration<float> dt = std::chrono::high_resolution_clock::now() - start;
+		m_systemsManager.update(dt.count());
+
+		// scenes without a renderer never present, the first update stands in for it
+		m_startupTimeline.markFirstFrame();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void GameController::updateSimulation(float dt)
+	{
+		m_accumulator += dt;
+
+		size_t steps = std::min(static_cast<size_t>(m_accumulator / m_fixedDt), m_maxStepsPerFrame);
+		const auto& transformSet = m_componentsManager.getComponentSet<Components::Transform>();
+		for (size_t step = 0; step < steps; step++)
+		{
+			// only the state before the last tick is needed for interpolation,
+			// assign reuses the buffers so a tick copies the transforms without allocating
+			if (step + 1 == steps)
+			{
+				m_previousTransformIds.assign(transformSet.getIds().begin(), transformSet.getIds().end());
+				m_previousTransforms.assign(transformSet.getElements().begin(), transformSet.getElements().end());
+			}
+			m_systemsManager.update(Systems::UpdateGroup::Fixed, m_fixedDt);
+			m_accumulator -= m_fixedDt;
+		}
+
+		// dropping the backlog keeps simulation cost bounded when frames are slow
+		if (m_accumulator >= m_fixedDt)
+		{
+			m_accumulator = std::fmod(m_accumulator, m_fixedDt);
+		}
+
+		m_interpolationAlpha = m_accumulator / m_fixedDt;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	bool GameController::isHeadlessRunFinished(size_t framesCount, double simulatedTime) const
+	{
+		if (!m_headless)
+		{
+			return false;
+		}
+
+		if (m_headlessSettings.frames > 0 && framesCount >= m_headlessSettings.frames)
+		{
+			return true;
+		}
+
+		return m_headlessSettings.duration > 0.0f && simulatedTime >= m_headlessSettings.duration;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void GameController::saveHeadlessSummary(double simulatedTime, double wallTime) const
+	{
+		nlohmann::json summary;
+		summary["config"] = m_configPath;
+		summary["frames"] = m_headlessFrameTimes.getCount();
+		summary["simulatedTime"] = simulatedTime;
+		summary["wallTime"] = wallTime;
+		summary["fixedDt"] = m_headlessSettings.fixedDt;
+
+		if (m_headlessFrameTimes.getCount() > 0)
+		{
+			nlohmann::json& frameTimeJson = summary["frameTimeMs"];
+			frameTimeJson["mean"] = m_headlessFrameTimes.getMean() * 1000.0f;
+			frameTimeJson["min"] = m_headlessFrameTimes.getMin() * 1000.0f;
+			frameTimeJson["median"] = m_headlessFrameTimes.getPercentile(50.0f) * 1000.0f;
+			frameTimeJson["percentile99"] = m_headlessFrameTimes.getPercentile(99.0f) * 1000.0f;
+			frameTimeJson["max"] = m_headlessFrameTimes.getMax() * 1000.0f;
+		}
+
+		if (m_headlessSettings.summaryPath.empty())
+		{
+			std::cout << summary.dump(4) << std::endl;
+			return;
+		}
+
+		std::ofstream outFile(m_headlessSettings.summaryPath);
+		ASSERT(outFile.is_open(), "Failed to open summary file {}", m_headlessSettings.summaryPath);
+		if (!outFile.is_open())
+		{
+			return;
+		}
+
+		outFile << summary.dump(4);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
 }
\ No newline at end of file
@@ -1,19 +1,36 @@
 #pragma once
 
+#include <thread>
+#include <atomic>
+
 #include "nlohmann/json.hpp"
 
 #include "EventsManager.h"
 #include "ComponentsManager.h"
 #include "SystemsManager.h"
 #include "EntitiesManager.h"
+#include "TasksManager.h"
+#include "ReplayManager.h"
+#include "AssetCache.h"
 
 #include "Visual/Window.h"
+#include "Components/Transform.h"
+#include "Utils/FrameLimiter.h"
+#include "Utils/HdrHistogram.h"
+#include "Utils/StartupTimeline.h"
 
 namespace Engine
 {
 	class GameController
 	{
 	public:
+		struct HeadlessSettings
+		{
+			size_t frames = 0;
+			float duration = 0.0f;
+			float fixedDt = 0.0f;
+			std::string summaryPath;
+		};
 
 		static GameController& get();
 
@@ -22,36 +39,89 @@ namespace Engine
 		void setConfig(const std::string& configPath);
 		std::string getConfigRelativePath(const std::string& path) const;
 		std::string getConfigPath() const;
+		void setHeadless(const HeadlessSettings& settings);
+		bool isHeadless() const;
 
 		void init();
 		void run();
+		void runStartupBenchmark(size_t iterations, const std::string& outputPath);
 		void clear();
 
 		EventsManager& getEventsManager();
 		ComponentsManager& getComponentsManager();
 		SystemsManager& getSystemsManager();
 		EntitiesManager& getEntitiesManager();
+		TasksManager& getTasksManager();
+		ReplayManager& getReplayManager();
+		AssetCache& getAssetCache();
 
 		const EventsManager& getEventsManager() const;
 		const ComponentsManager& getComponentsManager() const;
 		const SystemsManager& getSystemsManager() const;
 		const EntitiesManager& getEntitiesManager() const;
+		const TasksManager& getTasksManager() const;
+		const ReplayManager& getReplayManager() const;
+		const AssetCache& getAssetCache() const;
 
 		ComponentsFactory& getComponentsFactory();
 		const ComponentsFactory& getComponentsFactory() const;
 		SystemsFactory& getSystemsFactory();
 		const SystemsFactory& getSystemsFactory() const;
+		Utils::FrameLimiter& getFrameLimiter();
+		const Utils::FrameLimiter& getFrameLimiter() const;
+		Utils::StartupTimeline& getStartupTimeline();
+		const Utils::StartupTimeline& getStartupTimeline() const;
 
 		EntityID createPrefab(const std::string& prefabName);
 
+		bool isFixedTimestep() const;
+		float getInterpolationAlpha() const;
+		const Components::Transform* getPreviousTransform(EntityID id) const;
+
+	private:
+		struct SceneData
+		{
+			std::string configPath;
+			nlohmann::json config;
+			std::unordered_map<std::string, nlohmann::json> prefabs;
+			ComponentsManager componentsManager;
+			EntitiesManager entitiesManager;
+		};
+
+		// kept in one place so the config change listener captures a single reference
+		struct SceneSwitchState
+		{
+			bool inProgress = false;
+			bool reloadPending = false;
+			bool configChangeRequested = false;
+			std::string newConfigPath;
+			float longestFrame = 0.0f;
+			std::chrono::high_resolution_clock::time_point start;
+		};
 
 	private:
 		GameController() = default;
 		
-		void createEntity(const nlohmann::json& entityJson);
+		void createEntity(
+			ComponentsManager& componentsManager,
+			EntitiesManager& entitiesManager,
+			const std::unordered_map<std::string, nlohmann::json>& prefabs,
+			const nlohmann::json& entityJson);
+		void loadPrefabs(const nlohmann::json& config, std::unordered_map<std::string, nlohmann::json>& prefabs) const;
 		void initPrefabs();
 		void initEntities();
 		void initSystems();
+		void initSimulation();
+		void initFrameLimiter();
+		void initSceneLoading();
+		void startScenePreload(const std::string& configPath);
+		void preloadScene();
+		void swapPreloadedScene();
+		void waitForScenePreload();
+		void runUntilFirstFrame();
+		void updateSimulation(float dt);
+		bool isHeadlessRunFinished(size_t framesCount, double simulatedTime) const;
+		void saveHeadlessSummary(double simulatedTime, double wallTime) const;
 
 	private:
 		static constexpr const char* k_prefabsField = "Prefabs";
@@ -60,6 +130,14 @@ namespace Engine
 		static constexpr const char* k_nameField = "Name";
 		static constexpr const char* k_prefabField = "Prefab";
 		static constexpr const char* k_componentsField = "Components";
+		static constexpr const char* k_simulationField = "Simulation";
+		static constexpr const char* k_fixedTimestepField = "fixedTimestep";
+		static constexpr const char* k_tickRateField = "tickRate";
+		static constexpr const char* k_maxStepsPerFrameField = "maxStepsPerFrame";
+		static constexpr const char* k_frameLimiterField = "FrameLimiter";
+		static constexpr const char* k_targetFPSField = "targetFPS";
+		static constexpr const char* k_sceneLoadingField = "SceneLoading";
+		static constexpr const char* k_backgroundField = "background";
 
 		static std::unique_ptr<GameController> m_instance;
 
@@ -72,8 +150,31 @@ namespace Engine
 		ComponentsManager m_componentsManager;
 		SystemsManager m_systemsManager;
 		EntitiesManager m_entitiesManager;
+		TasksManager m_tasksManager{ m_eventsManager };
+		ReplayManager m_replayManager{ m_eventsManager };
+		AssetCache m_assetCache;
 		ComponentsFactory m_componentsFactory;
 		SystemsFactory m_systemsFactory;
+		Utils::FrameLimiter m_frameLimiter;
+		Utils::StartupTimeline m_startupTimeline;
+
+		bool m_fixedTimestep = false;
+		float m_fixedDt = 1.0f / 60.0f;
+		size_t m_maxStepsPerFrame = 5;
+		float m_accumulator = 0.0f;
+		float m_interpolationAlpha = 1.0f;
+		// dense transforms before the last tick, the ids tell whether a slot still belongs to the same entity
+		std::vector<EntityID> m_previousTransformIds;
+		std::vector<Components::Transform> m_previousTransforms;
+
+		bool m_headless = false;
+		HeadlessSettings m_headlessSettings;
+		Utils::HdrHistogram m_headlessFrameTimes;
+
+		bool m_backgroundSceneLoading = false;
+		std::thread m_preloadThread;
+		std::unique_ptr<SceneData> m_preloadedScene;
+		std::atomic<bool> m_scenePreloaded = false;
 	};
 
 
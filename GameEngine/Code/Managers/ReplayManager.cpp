@@ -0,0 +1,229 @@
+#include "ReplayManager.h"
+
+#include <fstream>
+
+#include "Utils/DebugMacros.h"
+
+namespace Engine
+{
+	//////////////////////////////////////////////////////////////////////////
+
+	ReplayManager::ReplayManager(EventsManager& eventsManager): m_eventsManager(eventsManager)
+	{
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	ReplayManager::~ReplayManager()
+	{
+		stop();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	bool ReplayManager::startRecording(const std::string& path)
+	{
+		stop();
+
+		m_mode = Mode::Record;
+		m_path = path;
+		m_keyListenerId = m_eventsManager.subscribe<Events::NativeKeyStateChanged>(
+			[this](const Events::NativeKeyStateChanged& event)
+			{
+				onKeyStateChanged(event);
+			}
+		);
+
+		return true;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	bool ReplayManager::startReplay(const std::string& path, float fixedDt)
+	{
+		stop();
+
+		std::ifstream file(path, std::ios::binary);
+		ASSERT(file.is_open(), "Failed to open replay file {}", path);
+		if (!file.is_open())
+		{
+			return false;
+		}
+
+		uint32_t magic = 0;
+		uint32_t version = 0;
+		uint32_t recordsCount = 0;
+		file.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+		file.read(reinterpret_cast<char*>(&version), sizeof(version));
+		file.read(reinterpret_cast<char*>(&m_framesCount), sizeof(m_framesCount));
+		file.read(reinterpret_cast<char*>(&recordsCount), sizeof(recordsCount));
+
+		bool validHeader = file.good() && magic == k_magic && version == k_version;
+		ASSERT(validHeader, "Invalid replay file {}", path);
+		if (!validHeader)
+		{
+			return false;
+		}
+
+		m_frameTimes.resize(m_framesCount);
+		file.read(reinterpret_cast<char*>(m_frameTimes.data()), m_frameTimes.size() * sizeof(float));
+
+		m_records.resize(recordsCount);
+		for (InputRecord& record : m_records)
+		{
+			file.read(reinterpret_cast<char*>(&record.frame), sizeof(record.frame));
+			file.read(reinterpret_cast<char*>(&record.key), sizeof(record.key));
+			file.read(reinterpret_cast<char*>(&record.pressed), sizeof(record.pressed));
+		}
+
+		ASSERT(file.good(), "Replay file {} is truncated", path);
+		if (!file.good())
+		{
+			m_records.clear();
+			m_frameTimes.clear();
+			return false;
+		}
+
+		m_mode = Mode::Replay;
+		m_path = path;
+		m_fixedDt = fixedDt;
+		return true;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void ReplayManager::stop()
+	{
+		if (m_mode == Mode::Record)
+		{
+			m_eventsManager.unsubscribe<Events::NativeKeyStateChanged>(m_keyListenerId);
+			saveRecording();
+		}
+
+		m_mode = Mode::None;
+		m_records.clear();
+		m_frameTimes.clear();
+		m_nextRecord = 0;
+		m_frameIndex = 0;
+		m_framesCount = 0;
+		m_fixedDt = 0.0f;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void ReplayManager::beginFrame()
+	{
+		if (m_mode != Mode::Replay)
+		{
+			return;
+		}
+
+		while (m_nextRecord < m_records.size() && m_records[m_nextRecord].frame == m_frameIndex)
+		{
+			const InputRecord& record = m_records[m_nextRecord];
+			m_eventsManager.enqueue(Events::NativeKeyStateChanged{ static_cast<WPARAM>(record.key), record.pressed != 0 });
+			m_nextRecord++;
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void ReplayManager::endFrame(float dt)
+	{
+		if (m_mode == Mode::None)
+		{
+			return;
+		}
+
+		m_frameIndex++;
+		if (m_mode == Mode::Record)
+		{
+			m_framesCount = m_frameIndex;
+			m_frameTimes.push_back(dt);
+			return;
+		}
+
+		if (m_frameIndex >= m_framesCount)
+		{
+			m_eventsManager.emit(Events::NativeExitRequested{});
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	float ReplayManager::getFrameDt() const
+	{
+		// an explicit fixed dt overrides the recorded frame times
+		if (m_fixedDt > 0.0f || m_frameIndex >= m_frameTimes.size())
+		{
+			return m_fixedDt;
+		}
+
+		return m_frameTimes[m_frameIndex];
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	ReplayManager::Mode ReplayManager::getMode() const
+	{
+		return m_mode;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	bool ReplayManager::isRecording() const
+	{
+		return m_mode == Mode::Record;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	bool ReplayManager::isReplaying() const
+	{
+		return m_mode == Mode::Replay;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	uint32_t ReplayManager::getFrameIndex() const
+	{
+		return m_frameIndex;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void ReplayManager::onKeyStateChanged(const Events::NativeKeyStateChanged& event)
+	{
+		m_records.push_back({ m_frameIndex, static_cast<uint32_t>(event.key), static_cast<uint8_t>(event.pressed) });
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	bool ReplayManager::saveRecording() const
+	{
+		std::ofstream file(m_path, std::ios::binary);
+		ASSERT(file.is_open(), "Failed to open recording file {}", m_path);
+		if (!file.is_open())
+		{
+			return false;
+		}
+
+		uint32_t recordsCount = static_cast<uint32_t>(m_records.size());
+		file.write(reinterpret_cast<const char*>(&k_magic), sizeof(k_magic));
+		file.write(reinterpret_cast<const char*>(&k_version), sizeof(k_version));
+		file.write(reinterpret_cast<const char*>(&m_framesCount), sizeof(m_framesCount));
+		file.write(reinterpret_cast<const char*>(&recordsCount), sizeof(recordsCount));
+		file.write(reinterpret_cast<const char*>(m_frameTimes.data()), m_frameTimes.size() * sizeof(float));
+
+		for (const InputRecord& record : m_records)
+		{
+			file.write(reinterpret_cast<const char*>(&record.frame), sizeof(record.frame));
+			file.write(reinterpret_cast<const char*>(&record.key), sizeof(record.key));
+			file.write(reinterpret_cast<const char*>(&record.pressed), sizeof(record.pressed));
+		}
+
+		return file.good();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+}
\ No newline at end of file
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include "EventsManager.h"
+#include "Events/NativeInputEvents.h"
+
+namespace Engine
+{
+	class ReplayManager
+	{
+	public:
+		enum class Mode
+		{
+			None,
+			Record,
+			Replay
+		};
+
+		explicit ReplayManager(EventsManager& eventsManager);
+		~ReplayManager();
+
+		ReplayManager(const ReplayManager&) = delete;
+		ReplayManager& operator=(const ReplayManager&) = delete;
+
+		bool startRecording(const std::string& path);
+		bool startReplay(const std::string& path, float fixedDt = 0.0f);
+		void stop();
+
+		void beginFrame();
+		void endFrame(float dt);
+		float getFrameDt() const;
+
+		Mode getMode() const;
+		bool isRecording() const;
+		bool isReplaying() const;
+		uint32_t getFrameIndex() const;
+
+	private:
+		struct InputRecord
+		{
+			uint32_t frame;
+			uint32_t key;
+			uint8_t pressed;
+		};
+
+		void onKeyStateChanged(const Events::NativeKeyStateChanged& event);
+		bool saveRecording() const;
+
+	private:
+		static constexpr uint32_t k_magic = 0x43455245; // "EREC"
+		static constexpr uint32_t k_version = 2;
+
+		EventsManager& m_eventsManager;
+		EventListenerID m_keyListenerId = -1;
+
+		Mode m_mode = Mode::None;
+		std::string m_path;
+		std::vector<InputRecord> m_records;
+		std::vector<float> m_frameTimes; // dt of every recorded frame, replayed as is for a frame-exact run
+		size_t m_nextRecord = 0;
+		uint32_t m_frameIndex = 0;
+		uint32_t m_framesCount = 0;
+		float m_fixedDt = 0.0f;
+	};
+}
\ No newline at end of file
@@ -1,6 +1,10 @@
 #include "SystemsManager.h"
 
+#include <typeinfo>
+
 #include "Utils/DebugMacros.h"
+#include "Utils/Profiler.h"
+#include "Utils/AllocationTracker.h"
 
 namespace Engine
 {
@@ -44,6 +48,12 @@ namespace Engine
 		while (!m_addedSystems.empty())
 		{
 			m_addedSystems.front()->onStart();
+
+			SystemTiming& timing = m_timings[m_addedSystems.front().get()];
+			timing.name = getSystemName(*m_addedSystems.front());
+			timing.allocationTag = Utils::AllocationTracker::get().registerTag(timing.name.c_str());
+			timing.budget = m_addedSystems.front()->getFrameBudget();
+
 			m_systems.emplace(std::move(m_addedSystems.front()));
 			m_addedSystems.pop();
 		}
@@ -59,6 +69,7 @@ namespace Engine
 			if (itr != m_systems.end())
 			{
 				(*itr)->onStop();
+				m_timings.erase(itr->get());
 				m_systems.erase(itr);
 			}
 			m_removedSystems.pop();
@@ -67,12 +78,195 @@ namespace Engine
 
 	//////////////////////////////////////////////////////////////////////////
 
-	void SystemsManager::update(float dt) const
+	void SystemsManager::update(float dt)
+	{
+		for (const std::unique_ptr<Systems::ISystem>& system : m_systems)
+		{
+			updateSystem(*system, dt);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void SystemsManager::update(Systems::UpdateGroup group, float dt)
+	{
+		for (const std::unique_ptr<Systems::ISystem>& system : m_systems)
+		{
+			if (system->getUpdateGroup() == group)
+			{
+				updateSystem(*system, dt);
+			}
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void SystemsManager::updateSystem(Systems::ISystem& system, float dt)
+	{
+		auto timingItr = m_timings.find(&system);
+		if (timingItr == m_timings.end())
+		{
+			return;
+		}
+		SystemTiming& timing = timingItr->second;
+		Utils::HardwareCounters& hardwareCounters = Utils::HardwareCounters::get();
+
+		Utils::HardwareCounters::Reading countersStart = hardwareCounters.read();
+		Clock::time_point start = Clock::now();
+		{
+			PROFILE_ZONE(typeid(system).name());
+			ALLOCATION_TAG_SCOPE(timing.allocationTag);
+			system.onUpdate(dt);
+		}
+		Clock::time_point end = Clock::now();
+		if (hardwareCounters.isAvailable())
+		{
+			timing.recordedCounters += hardwareCounters.read() - countersStart;
+		}
+
+		float duration = std::chrono::duration<float>(end - start).count();
+		timing.lastTime = duration;
+		timing.recentTimes.add(duration);
+		timing.recordedTimes.add(duration);
+
+		if (timing.budget > 0.0f && duration > timing.budget)
+		{
+			timing.budgetOverruns++;
+			timing.unreportedOverruns++;
+			timing.worstUnreportedOverrun = std::max(timing.worstUnreportedOverrun, duration);
+			reportOverruns(timing, end);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void SystemsManager::reportOverruns(SystemTiming& timing, Clock::time_point now)
 	{
+		// overruns are aggregated so that a system that is constantly over budget doesn't flood the log
+		if (now - timing.lastOverrunReport < k_overrunReportInterval)
+		{
+			return;
+		}
+
+		LOG_INFO(
+			"{} exceeded its {:.3f} ms budget {} times, worst update {:.3f} ms",
+			timing.name,
+			1000.0f * timing.budget,
+			timing.unreportedOverruns,
+			1000.0f * timing.worstUnreportedOverrun);
+
+		timing.lastOverrunReport = now;
+		timing.unreportedOverruns = 0;
+		timing.worstUnreportedOverrun = 0.0f;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	std::vector<SystemTimingStats> SystemsManager::getRecentTimings() const
+	{
+		std::vector<SystemTimingStats> timings;
 		for (const std::unique_ptr<Systems::ISystem>& system : m_systems)
 		{
-			system->onUpdate(dt);
+			const SystemTiming& timing = m_timings.at(system.get());
+			timings.push_back(getTimingStats(timing, timing.recentTimes, {}));
 		}
+		return timings;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void SystemsManager::getLastUpdateTimes(std::vector<SystemUpdateTime>& times) const
+	{
+		// filled in place so that callers sampling every frame can reuse the storage
+		times.resize(m_systems.size());
+		size_t i = 0;
+		for (const std::unique_ptr<Systems::ISystem>& system : m_systems)
+		{
+			const SystemTiming& timing = m_timings.at(system.get());
+			times[i].name = timing.name;
+			times[i].time = timing.lastTime;
+			times[i].medianTime = timing.recentTimes.getPercentile(50.0f);
+			i++;
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void SystemsManager::getLastUpdateTimes(std::vector<float>& times) const
+	{
+		times.resize(m_systems.size());
+		size_t i = 0;
+		for (const std::unique_ptr<Systems::ISystem>& system : m_systems)
+		{
+			times[i++] = m_timings.at(system.get()).lastTime;
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	std::vector<std::string> SystemsManager::getSystemNames() const
+	{
+		std::vector<std::string> names;
+		for (const std::unique_ptr<Systems::ISystem>& system : m_systems)
+		{
+			names.push_back(m_timings.at(system.get()).name);
+		}
+		return names;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	std::vector<SystemTimingStats> SystemsManager::getRecordedTimings() const
+	{
+		std::vector<SystemTimingStats> timings;
+		for (const std::unique_ptr<Systems::ISystem>& system : m_systems)
+		{
+			const SystemTiming& timing = m_timings.at(system.get());
+			timings.push_back(getTimingStats(timing, timing.recordedTimes, timing.recordedCounters));
+		}
+		return timings;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void SystemsManager::resetRecordedTimings()
+	{
+		for (auto& [system, timing] : m_timings)
+		{
+			timing.recordedTimes.clear();
+			timing.recordedCounters = {};
+			timing.budgetOverruns = 0;
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	std::string SystemsManager::getSystemName(const Systems::ISystem& system)
+	{
+		std::string name = typeid(system).name();
+		size_t namespaceEnd = name.rfind(':');
+		if (namespaceEnd != std::string::npos)
+		{
+			return name.substr(namespaceEnd + 1);
+		}
+		size_t keywordEnd = name.rfind(' ');
+		return keywordEnd != std::string::npos ? name.substr(keywordEnd + 1) : name;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	template <typename Histogram>
+	SystemTimingStats SystemsManager::getTimingStats(const SystemTiming& timing, const Histogram& times, const Utils::HardwareCounters::Values& counters)
+	{
+		return SystemTimingStats{
+			timing.name,
+			timing.budget,
+			timing.budgetOverruns,
+			times.getMean(),
+			times.getPercentile(99.0f),
+			times.getMax(),
+			times.getCount(),
+			counters };
 	}
 
 	//////////////////////////////////////////////////////////////////////////
@@ -92,6 +286,7 @@ namespace Engine
 		ASSERT(m_addedSystems.empty(), "There are still systems to be added");
 		ASSERT(m_removedSystems.empty(), "There are still systems to be removed");
 		m_systems.clear();
+		m_timings.clear();
 	}
 
 	//////////////////////////////////////////////////////////////////////////
@@ -5,10 +5,14 @@
 #include <queue>
 #include <memory>
 #include <functional>
+#include <chrono>
 
 #include "Utils/SparseSet.h"
 #include "Utils/BasicUtils.h"
+#include "Utils/RollingHistogram.h"
+#include "Utils/HdrHistogram.h"
 #include "Systems/ISystem.h"
+#include "Events/StatsEvents.h"
 
 namespace Engine
 {
@@ -31,13 +35,49 @@ namespace Engine
 	public:
 		void addSystem(std::unique_ptr<Systems::ISystem>&& system);
 		void removeSystem(Systems::ISystem* system);
-		void update(float dt) const;
+		void update(float dt);
+		void update(Systems::UpdateGroup group, float dt);
 		void stop() const;
 		void clear();
 		void processAddedSystems();
 		void processRemovedSystems();
 
+		std::vector<SystemTimingStats> getRecentTimings() const;
+		std::vector<SystemTimingStats> getRecordedTimings() const;
+		void resetRecordedTimings();
+		void getLastUpdateTimes(std::vector<SystemUpdateTime>& times) const;
+		// the times alone, in the order of getSystemNames, for callers that record them every frame
+		void getLastUpdateTimes(std::vector<float>& times) const;
+		std::vector<std::string> getSystemNames() const;
+
 	private:
+		using Clock = std::chrono::high_resolution_clock;
+
+		static constexpr size_t k_recentTimingsWindow = 256;
+		static constexpr std::chrono::seconds k_overrunReportInterval = std::chrono::seconds(1);
+
+		struct SystemTiming
+		{
+			std::string name;
+			size_t allocationTag = 0;
+			float budget = 0.0f;
+			size_t budgetOverruns = 0;
+			float lastTime = 0.0f;
+			Utils::RollingHistogram recentTimes{ k_recentTimingsWindow };
+			Utils::HdrHistogram recordedTimes;
+			Utils::HardwareCounters::Values recordedCounters;
+
+			size_t unreportedOverruns = 0;
+			float worstUnreportedOverrun = 0.0f;
+			Clock::time_point lastOverrunReport;
+		};
+
+		void updateSystem(Systems::ISystem& system, float dt);
+		void reportOverruns(SystemTiming& timing, Clock::time_point now);
+		static std::string getSystemName(const Systems::ISystem& system);
+		template <typename Histogram>
+		static SystemTimingStats getTimingStats(const SystemTiming& timing, const Histogram& times, const Utils::HardwareCounters::Values& counters);
+
 
 		struct LessPriority
 		{
@@ -48,6 +88,7 @@ namespace Engine
 		std::set<std::unique_ptr<Systems::ISystem>, LessPriority> m_systems;
 		std::queue<Systems::ISystem*> m_removedSystems;
 		std::queue<std::unique_ptr<Systems::ISystem>> m_addedSystems;
+		std::unordered_map<const Systems::ISystem*, SystemTiming> m_timings;
 	};
 
 }
@@ -0,0 +1,172 @@
+#include "TasksManager.h"
+
+#include <algorithm>
+
+namespace Engine
+{
+	//////////////////////////////////////////////////////////////////////////
+
+	bool TasksManager::NextFrameAwaiter::await_ready() const noexcept
+	{
+		return false;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void TasksManager::NextFrameAwaiter::await_suspend(std::coroutine_handle<> handle)
+	{
+		manager.m_nextFrameTasks.push_back(handle);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void TasksManager::NextFrameAwaiter::await_resume() const noexcept
+	{
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	bool TasksManager::DelayAwaiter::await_ready() const noexcept
+	{
+		return delay <= 0.0f;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void TasksManager::DelayAwaiter::await_suspend(std::coroutine_handle<> handle)
+	{
+		manager.m_timers.push(Timer{ manager.m_time + delay, handle });
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void TasksManager::DelayAwaiter::await_resume() const noexcept
+	{
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	TasksManager::TasksManager(EventsManager& eventsManager) : m_eventsManager(eventsManager)
+	{
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	TasksManager::~TasksManager()
+	{
+		clear();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void TasksManager::start(Utils::Task&& task)
+	{
+		Utils::Task::Handle handle = task.release();
+		if (!handle)
+		{
+			return;
+		}
+
+		handle.promise().manager = this;
+		m_tasks.push_back(handle);
+		handle.resume();
+		destroyFinishedTasks();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void TasksManager::update(float dt)
+	{
+		m_time += dt;
+		while (!m_timers.empty() && m_timers.top().wakeTime <= m_time)
+		{
+			m_readyTasks.push_back(m_timers.top().handle);
+			m_timers.pop();
+		}
+
+		m_readyTasks.insert(m_readyTasks.end(), m_nextFrameTasks.begin(), m_nextFrameTasks.end());
+		m_nextFrameTasks.clear();
+
+		// tasks that become ready while these are running are resumed on the next update
+		std::swap(m_readyTasks, m_resumingTasks);
+		for (std::coroutine_handle<> handle : m_resumingTasks)
+		{
+			handle.resume();
+		}
+		m_resumingTasks.clear();
+
+		destroyFinishedTasks();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void TasksManager::clear()
+	{
+		for (Utils::Task::Handle handle : m_tasks)
+		{
+			handle.destroy();
+		}
+
+		m_tasks.clear();
+		m_readyTasks.clear();
+		m_resumingTasks.clear();
+		m_nextFrameTasks.clear();
+		m_finishedTasks.clear();
+		m_timers = {};
+		m_time = 0.0f;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	size_t TasksManager::getActiveTasksCount() const
+	{
+		return m_tasks.size();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	TasksManager::NextFrameAwaiter TasksManager::nextFrame()
+	{
+		return NextFrameAwaiter{ *this };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	TasksManager::DelayAwaiter TasksManager::delay(float seconds)
+	{
+		return DelayAwaiter{ *this, seconds };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void TasksManager::onTaskFinished(std::coroutine_handle<> handle)
+	{
+		m_finishedTasks.push_back(handle);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void TasksManager::destroyFinishedTasks()
+	{
+		for (std::coroutine_handle<> handle : m_finishedTasks)
+		{
+			auto itr = std::find_if(m_tasks.begin(), m_tasks.end(), [handle](Utils::Task::Handle task) { return task.address() == handle.address(); });
+			if (itr != m_tasks.end())
+			{
+				*itr = m_tasks.back();
+				m_tasks.pop_back();
+			}
+			handle.destroy();
+		}
+		m_finishedTasks.clear();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	bool TasksManager::LaterWakeTime::operator()(const Timer& lhs, const Timer& rhs) const
+	{
+		return lhs.wakeTime > rhs.wakeTime;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+}
\ No newline at end of file
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <coroutine>
+#include <vector>
+#include <queue>
+#include <optional>
+#include <functional>
+
+#include "Utils/Task.h"
+#include "EventsManager.h"
+
+namespace Engine
+{
+	class TasksManager
+	{
+	public:
+		struct NextFrameAwaiter
+		{
+			bool await_ready() const noexcept;
+			void await_suspend(std::coroutine_handle<> handle);
+			void await_resume() const noexcept;
+
+			TasksManager& manager;
+		};
+
+		struct DelayAwaiter
+		{
+			bool await_ready() const noexcept;
+			void await_suspend(std::coroutine_handle<> handle);
+			void await_resume() const noexcept;
+
+			TasksManager& manager;
+			float delay;
+		};
+
+		template <typename EventType>
+		class EventAwaiter
+		{
+		public:
+			using Predicate = std::function<bool(const EventType&)>;
+
+			EventAwaiter(TasksManager& manager, Predicate predicate);
+			EventAwaiter(const EventAwaiter&) = delete;
+			EventAwaiter& operator=(const EventAwaiter&) = delete;
+			~EventAwaiter();
+
+			bool await_ready() const noexcept;
+			void await_suspend(std::coroutine_handle<> handle);
+			EventType await_resume();
+
+		private:
+			void unsubscribe();
+
+		private:
+			TasksManager& m_manager;
+			Predicate m_predicate;
+			std::optional<EventType> m_event;
+			EventListenerID m_listenerId = -1;
+			bool m_subscribed = false;
+		};
+
+	public:
+		explicit TasksManager(EventsManager& eventsManager);
+		TasksManager(const TasksManager&) = delete;
+		TasksManager& operator=(const TasksManager&) = delete;
+		~TasksManager();
+
+		void start(Utils::Task&& task);
+		void update(float dt);
+		void clear();
+		size_t getActiveTasksCount() const;
+
+		NextFrameAwaiter nextFrame();
+		DelayAwaiter delay(float seconds);
+		template <typename EventType>
+		EventAwaiter<EventType> waitForEvent(typename EventAwaiter<EventType>::Predicate predicate = nullptr);
+
+		void onTaskFinished(std::coroutine_handle<> handle);
+
+	private:
+		struct Timer
+		{
+			float wakeTime;
+			std::coroutine_handle<> handle;
+		};
+
+		struct LaterWakeTime
+		{
+			bool operator()(const Timer& lhs, const Timer& rhs) const;
+		};
+
+	private:
+		void destroyFinishedTasks();
+
+	private:
+		EventsManager& m_eventsManager;
+		float m_time = 0.0f;
+
+		std::vector<Utils::Task::Handle> m_tasks;
+		std::vector<std::coroutine_handle<>> m_readyTasks;
+		std::vector<std::coroutine_handle<>> m_resumingTasks;
+		std::vector<std::coroutine_handle<>> m_nextFrameTasks;
+		std::vector<std::coroutine_handle<>> m_finishedTasks;
+		std::priority_queue<Timer, std::vector<Timer>, LaterWakeTime> m_timers;
+	};
+}
+
+#include "TasksManager.inl"
\ No newline at end of file
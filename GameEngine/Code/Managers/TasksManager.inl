@@ -0,0 +1,83 @@
+#pragma once
+
+#include "TasksManager.h"
+
+namespace Engine
+{
+	//////////////////////////////////////////////////////////////////////////
+
+	template <typename EventType>
+	TasksManager::EventAwaiter<EventType>::EventAwaiter(TasksManager& manager, Predicate predicate)
+		: m_manager(manager)
+		, m_predicate(std::move(predicate))
+	{
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	template <typename EventType>
+	TasksManager::EventAwaiter<EventType>::~EventAwaiter()
+	{
+		unsubscribe();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	template <typename EventType>
+	bool TasksManager::EventAwaiter<EventType>::await_ready() const noexcept
+	{
+		return false;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	template <typename EventType>
+	void TasksManager::EventAwaiter<EventType>::await_suspend(std::coroutine_handle<> handle)
+	{
+		m_listenerId = m_manager.m_eventsManager.subscribe<EventType>(
+			[this, handle](const EventType& event)
+			{
+				if (m_event.has_value() || (m_predicate && !m_predicate(event)))
+				{
+					return;
+				}
+				m_event.emplace(event);
+				m_manager.m_readyTasks.push_back(handle);
+			}
+		);
+		m_subscribed = true;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	template <typename EventType>
+	EventType TasksManager::EventAwaiter<EventType>::await_resume()
+	{
+		// resumed from TasksManager::update, so it is safe to unsubscribe outside of emit
+		unsubscribe();
+		return std::move(*m_event);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	template <typename EventType>
+	void TasksManager::EventAwaiter<EventType>::unsubscribe()
+	{
+		if (!m_subscribed)
+		{
+			return;
+		}
+		m_manager.m_eventsManager.unsubscribe<EventType>(m_listenerId);
+		m_subscribed = false;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	template <typename EventType>
+	TasksManager::EventAwaiter<EventType> TasksManager::waitForEvent(typename EventAwaiter<EventType>::Predicate predicate)
+	{
+		return EventAwaiter<EventType>(*this, std::move(predicate));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+}
\ No newline at end of file
@@ -0,0 +1,139 @@
+#include "EventsBenchmarkSystem.h"
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+
+#include "Managers/GameController.h"
+#include "Events/NativeInputEvents.h"
+#include "Utils/DebugMacros.h"
+
+REGISTER_SYSTEM(Engine::Systems::EventsBenchmarkSystem);
+
+namespace Engine::Systems
+{
+	//////////////////////////////////////////////////////////////////////////
+
+	void EventsBenchmarkSystem::onStart()
+	{
+		if (m_config.contains("listenerCounts"))
+		{
+			m_listenerCounts = m_config["listenerCounts"].get<std::vector<size_t>>();
+		}
+
+		if (m_config.contains("iterations"))
+		{
+			m_iterations = m_config["iterations"].get<size_t>();
+		}
+
+		if (m_config.contains("outputFile"))
+		{
+			m_outputPath = GameController::get().getConfigRelativePath(m_config["outputFile"]);
+		}
+
+		m_finished = false;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void EventsBenchmarkSystem::onUpdate(float dt)
+	{
+		if (m_finished)
+		{
+			return;
+		}
+
+		std::vector<BenchmarkResult> results;
+		for (size_t listenersCount : m_listenerCounts)
+		{
+			results.push_back(runBenchmark(listenersCount));
+		}
+
+		saveResults(results);
+
+		m_finished = true;
+		GameController::get().getEventsManager().emit(Events::NativeExitRequested{});
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void EventsBenchmarkSystem::onStop()
+	{
+
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	int EventsBenchmarkSystem::getPriority() const
+	{
+		return 0;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	EventsBenchmarkSystem::BenchmarkResult EventsBenchmarkSystem::runBenchmark(size_t listenersCount) const
+	{
+		// a separate manager keeps the engine listeners out of the measurement
+		EventsManager eventsManager;
+		size_t sink = 0;
+
+		for (size_t i = 0; i < listenersCount; i++)
+		{
+			eventsManager.subscribe<BenchmarkEvent>([&sink](const BenchmarkEvent& event) { sink += event.value; });
+		}
+
+		BenchmarkResult result{ listenersCount, 0.0, 0.0 };
+
+		auto start = std::chrono::high_resolution_clock::now();
+		for (size_t i = 0; i < m_iterations; i++)
+		{
+			eventsManager.emit(BenchmarkEvent{ i });
+		}
+		std::chrono::duration<double, std::nano> emitTime = std::chrono::high_resolution_clock::now() - start;
+		result.emitTime = emitTime.count() / m_iterations;
+
+		start = std::chrono::high_resolution_clock::now();
+		for (size_t i = 0; i < m_iterations; i++)
+		{
+			eventsManager.enqueue(BenchmarkEvent{ i });
+		}
+		eventsManager.dispatchAll();
+		std::chrono::duration<double, std::nano> batchedTime = std::chrono::high_resolution_clock::now() - start;
+		result.batchedTime = batchedTime.count() / m_iterations;
+
+		ASSERT(sink != 0 || m_iterations <= 1, "Benchmark listeners were not called");
+		return result;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void EventsBenchmarkSystem::saveResults(const std::vector<BenchmarkResult>& results) const
+	{
+		for (const BenchmarkResult& result : results)
+		{
+			std::cout << "Listeners: " << result.listenersCount << ", emit: " << result.emitTime << " ns, enqueue + dispatch: " << result.batchedTime << " ns" << std::endl;
+		}
+
+		if (m_outputPath.empty())
+		{
+			return;
+		}
+
+		std::ofstream outFile(m_outputPath);
+		if (!outFile.is_open())
+		{
+			return;
+		}
+
+		outFile << "Iterations: " << m_iterations << std::endl;
+		for (const BenchmarkResult& result : results)
+		{
+			outFile << "Listeners: " << result.listenersCount << std::endl;
+			outFile << "Emit time per event (ns): " << result.emitTime << std::endl;
+			outFile << "Emit throughput (events/s): " << 1e9 / result.emitTime << std::endl;
+			outFile << "Enqueue + dispatch time per event (ns): " << result.batchedTime << std::endl;
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+}
\ No newline at end of file
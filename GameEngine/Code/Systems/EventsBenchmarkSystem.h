@@ -0,0 +1,41 @@
+#pragma once
+
+#include "ISystem.h"
+
+#include <vector>
+#include <string>
+
+namespace Engine::Systems
+{
+	class EventsBenchmarkSystem: public ISystem
+	{
+	public:
+		void onStart() override;
+		void onUpdate(float dt) override;
+		void onStop() override;
+		int getPriority() const override;
+
+	private:
+		struct BenchmarkEvent
+		{
+			size_t value;
+		};
+
+		struct BenchmarkResult
+		{
+			size_t listenersCount;
+			double emitTime;
+			double batchedTime;
+		};
+
+	private:
+		BenchmarkResult runBenchmark(size_t listenersCount) const;
+		void saveResults(const std::vector<BenchmarkResult>& results) const;
+
+	private:
+		std::vector<size_t> m_listenerCounts = { 1, 10, 100 };
+		size_t m_iterations = 1000000;
+		std::string m_outputPath;
+		bool m_finished = false;
+	};
+}
\ No newline at end of file
@@ -25,26 +25,32 @@ namespace Engine::Systems
 		ASSERT(m_config.contains("experimentTime"), "experientTime field not found in experiment config");
 		if (m_config.contains("experimentTime"))
 		{
-			m_timeLeft = m_config["experimentTime"].get<float>();
+			m_experimentTime = m_config["experimentTime"].get<float>();
 		}
+
+		GameController::get().getTasksManager().start(runExperimentTimer());
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 
 	void ExperimentSystemBase::onUpdate(float dt)
 	{
-		checkExperimentEnd(dt);
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 
-	void ExperimentSystemBase::checkExperimentEnd(float dt)
+	UpdateGroup ExperimentSystemBase::getUpdateGroup() const
 	{
-		m_timeLeft -= dt;
-		if (m_timeLeft <= 0)
-		{
-			GameController::get().getEventsManager().emit(Engine::Events::NativeExitRequested{});
-		}
+		return UpdateGroup::Fixed;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	Utils::Task ExperimentSystemBase::runExperimentTimer()
+	{
+		// the tasks advance by the frame dt, which is the recorded or fixed one in replays and headless runs
+		co_await GameController::get().getTasksManager().delay(m_experimentTime);
+		GameController::get().getEventsManager().emit(Engine::Events::NativeExitRequested{});
 	}
 
 	//////////////////////////////////////////////////////////////////////////
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "ISystem.h"
+#include "Utils/Task.h"
 
 namespace Engine::Systems
 {
@@ -9,13 +10,14 @@ namespace Engine::Systems
 	public:
 		void onStart() override;
 		void onUpdate(float dt) override;
+		UpdateGroup getUpdateGroup() const override;
 	private:
-		void checkExperimentEnd(float dt);
+		Utils::Task runExperimentTimer();
 	protected:
 		static constexpr const char* k_experimentObjectTag = "ExperimentObject";
 
 		std::string m_prefabName = "Cube";
 		size_t m_prefabsCount = 10;
-		float m_timeLeft = 10.0f;
+		float m_experimentTime = 10.0f;
 	};
 }
\ No newline at end of file
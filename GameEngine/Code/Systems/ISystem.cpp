@@ -10,4 +10,23 @@ namespace Engine::Systems
 	}
 
 	//////////////////////////////////////////////////////////////////////////
+
+	UpdateGroup ISystem::getUpdateGroup() const
+	{
+		return UpdateGroup::Frame;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	float ISystem::getFrameBudget() const
+	{
+		// budgets are configured in milliseconds, zero means the system is not budgeted
+		if (!m_config.contains(k_frameBudgetField))
+		{
+			return 0.0f;
+		}
+		return m_config[k_frameBudgetField].get<float>() / 1000.0f;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
 }
\ No newline at end of file
@@ -4,6 +4,12 @@
 
 namespace Engine::Systems
 {
+	enum class UpdateGroup
+	{
+		Frame,
+		Fixed
+	};
+
 	class ISystem
 	{
 	public:
@@ -13,9 +19,13 @@ namespace Engine::Systems
 		virtual void onUpdate(float dt) = 0;
 		virtual void onStop() = 0;
 		virtual int getPriority() const = 0;
+		virtual UpdateGroup getUpdateGroup() const;
+		virtual float getFrameBudget() const;
 
 		virtual ~ISystem() = default;
 	protected:
+		static constexpr const char* k_frameBudgetField = "frameBudgetMs";
+
 		nlohmann::json m_config;
 	};
 }
\ No newline at end of file
@@ -15,10 +15,13 @@ namespace Engine::Systems
 
 	void InputSystem::onStart()
 	{
-		m_keyStateChangedListenerId = GameController::get().getEventsManager().subscribe<Events::NativeKeyStateChanged>(
-			[this](const Events::NativeKeyStateChanged& e)
+		m_keyStateChangedListenerId = GameController::get().getEventsManager().subscribeBatch<Events::NativeKeyStateChanged>(
+			[this](std::span<const Events::NativeKeyStateChanged> events)
 			{
-				m_keyStates[(char)e.key] = e.pressed;
+				for (const Events::NativeKeyStateChanged& e : events)
+				{
+					m_keyStates[(char)e.key] = e.pressed;
+				}
 			}
 		);
 
@@ -81,6 +84,13 @@ namespace Engine::Systems
 
 	//////////////////////////////////////////////////////////////////////////
 
+	UpdateGroup InputSystem::getUpdateGroup() const
+	{
+		return UpdateGroup::Fixed;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
 	bool InputSystem::isPressed(char key) const
 	{
 		auto itr = m_keyStates.find(key);
@@ -17,6 +17,7 @@ namespace Engine::Systems
 		void onUpdate(float dt) override;
 		void onStop() override;
 		int getPriority() const override;
+		UpdateGroup getUpdateGroup() const override;
 
 	private:
 		bool isPressed(char key) const;
@@ -1,5 +1,7 @@
 #include "RenderingSystem.h"
 
+#include <filesystem>
+
 #include "imgui.h"
 #include "backends/imgui_impl_win32.h"
 
@@ -8,8 +10,12 @@
 #include "Components/Model.h"
 #include "Utils/Parser.h"
 #include "Events/UIEvents.h"
+#include "Events/AssetEvents.h"
 #include "Utils/BasicUtils.h"
 #include "Utils/DebugMacros.h"
+#include "Utils/Profiler.h"
+#include "Utils/AllocationTracker.h"
+#include "Visual/ProfiledRenderer.h"
 #include "Managers/GameController.h"
 
 REGISTER_SYSTEM(Engine::Systems::RenderingSystem);
@@ -31,6 +37,9 @@ namespace Engine::Systems
 		}
 
 		m_uiController = std::make_unique<Visual::UIController>(m_rendererNames);
+
+		// not offered in the UI, it is only used by headless runs
+		m_rendererCreators[k_nullRendererName] = []() { return std::make_unique<Visual::NullRenderer>(); };
 	}
 
 	//////////////////////////////////////////////////////////////////////////
@@ -41,23 +50,56 @@ namespace Engine::Systems
 		EventsManager& eventsManager = GameController::get().getEventsManager();
 		m_rendererUpdateListenerId = eventsManager.subscribe<Events::RendererUpdate>([this](const Events::RendererUpdate& i_event) {m_nextRendererName = i_event.rendererName; });
 
-#ifdef _SHOWUI
-		m_uiController->init();
-#endif
+		m_headless = GameController::get().isHeadless();
 
 		if (m_config.contains("lightDirection"))
 		{
 			Utils::Parser::fillFromJson(m_lightDirection, m_config["lightDirection"]);
 		}
 
-		if (m_config.contains("renderer"))
+		if (m_config.contains("modelUploadsPerFrame"))
+		{
+			m_modelUploadsPerFrame = m_config["modelUploadsPerFrame"].get<size_t>();
+		}
+
+		std::string rendererName;
+		if (m_headless)
 		{
-			setRenderer(m_config["renderer"]);
+			rendererName = k_nullRendererName;
+		}
+		else if (m_config.contains("renderer"))
+		{
+			rendererName = getAvailableRendererName(m_config["renderer"]);
 		}
 		else
 		{
-			setRenderer("");
+			rendererName = getAvailableRendererName("");
+		}
+
+		// the previous scene's renderer and UI are reused when the backend stays the same
+		AssetCache& assetCache = GameController::get().getAssetCache();
+		if (assetCache.hasRenderer(rendererName))
+		{
+			m_uiController = assetCache.takeUIController();
+#ifdef _SHOWUI
+			if (!m_headless)
+			{
+				m_uiController->reset();
+			}
+#endif
 		}
+		else
+		{
+			assetCache.clear();
+#ifdef _SHOWUI
+			if (!m_headless)
+			{
+				m_uiController->init();
+			}
+#endif
+		}
+
+		setRenderer(rendererName);
 
 		m_nextRendererName = m_rendererName;
 
@@ -81,11 +123,14 @@ namespace Engine::Systems
 	{
 		auto& gameController = GameController::get();
 		auto& compManager = gameController.getComponentsManager();
-		const auto& cameraTransform = compManager.getComponentSet<Components::Transform>().getElement(m_cameraId);
+		const Components::Transform cameraTransform = getRenderTransform(m_cameraId, compManager.getComponentSet<Components::Transform>().getElement(m_cameraId));
 		m_renderer->setCameraProperties(cameraTransform.position, cameraTransform.rotation);
 
 		auto& modelSet = compManager.getComponentSet<Components::Model>();
 		const auto& transformSet = compManager.getComponentSet<Components::Transform>();
+		AssetCache& assetCache = gameController.getAssetCache();
+		size_t modelUploads = 0;
+		size_t pendingModels = 0;
 
 		m_renderer->clearBackground(0.0f, 0.2f, 0.4f, 1.0f);
 		for (EntityID id : compManager.entitiesWithComponents<Components::Model, Components::Transform>())
@@ -101,26 +146,41 @@ namespace Engine::Systems
 			
 			if (!model.instance)
 			{
-				bool loadResult = m_renderer->loadModel(gameController.getConfigRelativePath(model.path));
-				ASSERT(loadResult, "Failed to load model: {}", gameController.getConfigRelativePath(model.path));
-				if (!loadResult)
+				// models that are not resident yet are uploaded within the per frame budget
+				bool needsUpload = !assetCache.isModelResident(gameController.getConfigRelativePath(model.path));
+				if (needsUpload && m_modelUploadsPerFrame > 0 && modelUploads >= m_modelUploadsPerFrame)
+				{
+					pendingModels++;
+					continue;
+				}
+
+				modelUploads += needsUpload ? 1 : 0;
+				if (!instantiateModel(model))
 				{
 					continue;
 				}
-				model.instance = m_renderer->createModelInstance(gameController.getConfigRelativePath(model.path));
 			}
 
-			const Components::Transform& transform = transformSet.getElement(id);
+			const Components::Transform transform = getRenderTransform(id, transformSet.getElement(id));
 			m_renderer->draw(*model.instance, transform.position, transform.rotation, transform.scale);
 		}
 
+		assetCache.setPendingModels(pendingModels);
+
 #ifdef _SHOWUI
-		m_renderer->preRenderUI();
-		m_uiController->render(dt);
-		m_renderer->postRenderUI();
+		if (!m_headless)
+		{
+			m_renderer->preRenderUI();
+			m_uiController->render(dt);
+			m_renderer->postRenderUI();
+		}
 #endif
 
+		auto presentStart = std::chrono::high_resolution_clock::now();
 		m_renderer->render();
+		std::chrono::duration<float> presentTime = std::chrono::high_resolution_clock::now() - presentStart;
+		gameController.getStartupTimeline().markFirstFrame();
+		gameController.getEventsManager().emit<Events::RendererFrameStatsUpdate>(Events::RendererFrameStatsUpdate{ m_renderer->getFrameStats(), presentTime.count() });
 
 		if (m_nextRendererName != m_rendererName)
 		{
@@ -133,10 +193,9 @@ namespace Engine::Systems
 
 	void RenderingSystem::onStop()
 	{
-		removeRenderer();
-#ifdef _SHOWUI
-		m_uiController->cleanUp();
-#endif
+		// the renderer outlives the scene, the game controller releases it on exit
+		destroyModelInstances();
+		GameController::get().getAssetCache().storeRenderer(m_rendererName, std::move(m_renderer), std::move(m_uiController));
 		GameController::get().getEventsManager().unsubscribe<Events::RendererUpdate>(m_rendererUpdateListenerId);
 	}
 
@@ -150,6 +209,17 @@ namespace Engine::Systems
 	//////////////////////////////////////////////////////////////////////////
 
 	void RenderingSystem::removeRenderer()
+	{
+		destroyModelInstances();
+
+		m_renderer->cleanUp();
+		m_renderer = nullptr;
+		GameController::get().getAssetCache().resetResidentModels();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void RenderingSystem::destroyModelInstances()
 	{
 		auto& compManager = GameController::get().getComponentsManager();
 
@@ -164,51 +234,147 @@ namespace Engine::Systems
 				model.instance = nullptr;
 			}
 		}
-
-		m_renderer->cleanUp();
-		m_renderer = nullptr;
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 
 	void RenderingSystem::setRenderer(const std::string& rendererName)
 	{
-		const auto& itr = m_rendererCreators.find(rendererName);
-		if (itr != m_rendererCreators.end())
+		auto& gameController = GameController::get();
+		auto& compManager = gameController.getComponentsManager();
+		auto& modelSet = compManager.getComponentSet<Components::Model>();
+		AssetCache& assetCache = gameController.getAssetCache();
+
+		std::unordered_set<std::string> usedModels;
+		for (EntityID id : compManager.entitiesWithComponents<Components::Model, Components::Transform>())
 		{
-			m_renderer = itr->second();
-			m_rendererName = rendererName;
+			usedModels.insert(gameController.getConfigRelativePath(modelSet.getElement(id).path));
 		}
 
-		if (!m_renderer)
+		m_rendererName = getAvailableRendererName(rendererName);
+		if (assetCache.hasRenderer(m_rendererName))
 		{
-			const auto& itr = m_rendererCreators.begin();
-			m_renderer = itr->second();
-			m_rendererName = itr->first;
+			m_renderer = assetCache.takeRenderer();
+			for (const std::string& modelPath : assetCache.evictUnusedModels(usedModels))
+			{
+				m_renderer->unloadModel(modelPath);
+			}
+		}
+		else
+		{
+			auto initStart = Utils::StartupTimeline::Clock::now();
+			m_renderer = m_rendererCreators[m_rendererName]();
+#ifdef _PROFILE
+			m_renderer = std::make_unique<Visual::ProfiledRenderer>(std::move(m_renderer));
+#endif
+			m_renderer->init(m_window);
+			gameController.getStartupTimeline().addPhase(m_rendererName + " init", Utils::StartupTimeline::k_backendCategory, initStart);
+			assetCache.resetResidentModels();
+			// nothing is resident in a new renderer, this only drops parsed models the scene doesn't use
+			assetCache.evictUnusedModels(usedModels);
 		}
 
-		m_renderer->init(m_window);
 		m_renderer->setLightProperties(m_lightDirection, 1.0f);
 
+		// with an upload budget the models are instantiated over the next frames instead
+		if (m_modelUploadsPerFrame == 0)
+		{
+			for (EntityID id : compManager.entitiesWithComponents<Components::Model, Components::Transform>())
+			{
+				instantiateModel(modelSet.getElement(id));
+			}
+		}
+
+		m_uiController->setRenderer(m_rendererName);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	bool RenderingSystem::instantiateModel(Components::Model& model)
+	{
 		auto& gameController = GameController::get();
-		auto& compManager = gameController.getComponentsManager();
-		auto& modelSet = compManager.getComponentSet<Components::Model>();
+		std::string modelPath = gameController.getConfigRelativePath(model.path);
 
-		for (EntityID id : compManager.entitiesWithComponents<Components::Model, Components::Transform>())
+		AssetCache& assetCache = gameController.getAssetCache();
+		float loadTime = 0.0f;
+		if (assetCache.isModelResident(modelPath))
 		{
-			Components::Model& model = modelSet.getElement(id);
-
-			bool loadResult = m_renderer->loadModel(gameController.getConfigRelativePath(model.path));
-			ASSERT(loadResult, "Failed to load model: {}", gameController.getConfigRelativePath(model.path));
+			assetCache.addReusedModel();
+		}
+		else
+		{
+			auto loadStart = std::chrono::high_resolution_clock::now();
+			bool loadResult = loadModel(modelPath);
+			loadTime = std::chrono::duration<float>(std::chrono::high_resolution_clock::now() - loadStart).count();
+			ASSERT(loadResult, "Failed to load model: {}", modelPath);
 			if (!loadResult)
 			{
-				continue;
+				return false;
 			}
+		}
+
+		model.instance = m_renderer->createModelInstance(modelPath);
+		gameController.getEventsManager().emit(Events::ModelLoaded{ model.path, loadTime });
+		return true;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	bool RenderingSystem::loadModel(const std::string& modelPath)
+	{
+		PROFILE_ZONE("RenderingSystem::loadModel");
+		ALLOCATION_SCOPE("Assets");
+		auto& gameController = GameController::get();
+		AssetCache& assetCache = gameController.getAssetCache();
 
-			model.instance = m_renderer->createModelInstance(gameController.getConfigRelativePath(model.path));
+		// the parsed model is shared with preloading and other renderers, only the upload is done here
+		auto loadStart = Utils::StartupTimeline::Clock::now();
+		std::shared_ptr<const Visual::ModelFile> modelFile = assetCache.loadModelFile(modelPath);
+		if (!modelFile || !m_renderer->loadModel(modelPath, *modelFile))
+		{
+			return false;
 		}
 
-		m_uiController->setRenderer(m_rendererName);
+		Utils::StartupTimeline& startupTimeline = gameController.getStartupTimeline();
+		if (!startupTimeline.hasFirstFrame())
+		{
+			std::string assetName = std::filesystem::path(modelPath).filename().string();
+			startupTimeline.addPhase(assetName, Utils::StartupTimeline::k_assetCategory, loadStart);
+		}
+		assetCache.addResidentModel(modelPath);
+		return true;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	std::string RenderingSystem::getAvailableRendererName(const std::string& rendererName) const
+	{
+		if (m_rendererCreators.contains(rendererName))
+		{
+			return rendererName;
+		}
+
+		return m_rendererCreators.begin()->first;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	Components::Transform RenderingSystem::getRenderTransform(EntityID id, const Components::Transform& transform) const
+	{
+		const GameController& gameController = GameController::get();
+		const Components::Transform* previous = gameController.isFixedTimestep() ? gameController.getPreviousTransform(id) : nullptr;
+		if (!previous)
+		{
+			return transform;
+		}
+
+		float alpha = gameController.getInterpolationAlpha();
+
+		Components::Transform result;
+		result.position = Utils::Vector3::lerp(previous->position, transform.position, alpha);
+		result.rotation = Utils::Vector3::lerpAngles(previous->rotation, transform.rotation, alpha);
+		result.scale = Utils::Vector3::lerp(previous->scale, transform.scale, alpha);
+		return result;
 	}
 
 	//////////////////////////////////////////////////////////////////////////
@@ -4,10 +4,12 @@
 #include "Visual/DirectXRenderer.h"
 #include "Visual/OpenGLRenderer.h"
 #include "Visual/VulkanRenderer.h"
+#include "Visual/NullRenderer.h"
 
 #include "Visual/Window.h"
 #include "Visual/UIController.h"
 #include "Components/Transform.h"
+#include "Components/Model.h"
 #include "Managers/EntitiesManager.h"
 #include "Managers/EventsManager.h"
 #include "Events/StatsEvents.h"
@@ -24,8 +26,15 @@ namespace Engine::Systems
 		int getPriority() const override;
 	private:
 		void removeRenderer();
+		void destroyModelInstances();
 		void setRenderer(const std::string& rendererName);
+		bool instantiateModel(Components::Model& model);
+		bool loadModel(const std::string& modelPath);
+		std::string getAvailableRendererName(const std::string& rendererName) const;
+		Components::Transform getRenderTransform(EntityID id, const Components::Transform& transform) const;
 	private:
+		static constexpr const char* k_nullRendererName = "Null";
+
 		std::map<std::string, std::function<std::unique_ptr<Visual::IRenderer>()>> m_rendererCreators;
 		std::vector<std::string> m_rendererNames;
 
@@ -38,6 +47,8 @@ namespace Engine::Systems
 
 		Utils::Vector3 m_lightDirection = Utils::Vector3(0, 0, -1);
 		EntityID m_cameraId = -1;
+		size_t m_modelUploadsPerFrame = 0;
+		bool m_headless = false;
 
 		EventListenerID m_rendererUpdateListenerId = -1;
 		
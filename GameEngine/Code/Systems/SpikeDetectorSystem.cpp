@@ -0,0 +1,391 @@
+#include "SpikeDetectorSystem.h"
+
+#include <iostream>
+#include <fstream>
+#include <format>
+
+#include "Utils/DebugMacros.h"
+#include "Utils/AllocationTracker.h"
+#include "Managers/GameController.h"
+#include "Events/AssetEvents.h"
+
+REGISTER_SYSTEM(Engine::Systems::SpikeDetectorSystem);
+
+namespace Engine::Systems
+{
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void SpikeDetectorSystem::onStart()
+	{
+		if (m_config.contains("spikeRatio"))
+		{
+			m_spikeRatio = m_config["spikeRatio"].get<float>();
+		}
+
+		if (m_config.contains("minSpikeTimeMs"))
+		{
+			m_minSpikeTime = m_config["minSpikeTimeMs"].get<float>() / 1000.0f;
+		}
+
+		if (m_config.contains("maxCaptures"))
+		{
+			m_maxCaptures = m_config["maxCaptures"].get<size_t>();
+		}
+
+		if (m_config.contains("captureFile"))
+		{
+			m_capturePath = GameController::get().getConfigRelativePath(m_config["captureFile"]);
+		}
+
+		size_t capturedFrames = 60;
+		if (m_config.contains("capturedFrames"))
+		{
+			capturedFrames = std::max<size_t>(m_config["capturedFrames"].get<size_t>(), 1);
+		}
+		m_frames.resize(capturedFrames);
+
+		EventsManager& eventsManager = GameController::get().getEventsManager();
+		m_rendererStatsListenerId = eventsManager.subscribe<Events::RendererFrameStatsUpdate>(
+			[this](const Events::RendererFrameStatsUpdate& update)
+			{
+				m_rendererStats = update.stats;
+				m_presentTime = update.presentTime;
+			});
+		m_modelLoadedListenerId = eventsManager.subscribe<Events::ModelLoaded>(
+			[this](const Events::ModelLoaded& loaded)
+			{
+				m_loadedModels++;
+				m_assetLoadTime += loaded.loadTime;
+			});
+
+		if (!m_capturePath.empty())
+		{
+			startWriter();
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void SpikeDetectorSystem::onUpdate(float dt)
+	{
+		// the detector runs before the other systems, so everything it samples belongs to the frame that dt measures
+		FrameRecord& frame = m_frames[m_framesCount % m_frames.size()];
+		frame.frameIndex = m_framesCount;
+		frame.frameTime = dt;
+		frame.medianFrameTime = m_frameTimes.getPercentile(50.0f);
+		frame.presentTime = m_presentTime;
+		frame.medianPresentTime = m_presentTimes.getPercentile(50.0f);
+		frame.allocations = Utils::AllocationTracker::get().getLastFrameAllocations();
+		frame.loadedModels = m_loadedModels;
+		frame.assetLoadTime = m_assetLoadTime;
+		frame.start = Utils::Profiler::Clock::now() - std::chrono::duration_cast<Utils::Profiler::Clock::duration>(std::chrono::duration<float>(dt));
+		frame.rendererStats = m_rendererStats;
+		GameController::get().getSystemsManager().getLastUpdateTimes(frame.systems);
+
+		m_framesCount++;
+		m_loadedModels = 0;
+		m_assetLoadTime = 0.0f;
+		m_frameTimes.add(dt);
+		m_presentTimes.add(frame.presentTime);
+
+		bool isSpike = m_frameTimes.getCount() > k_minFramesForDetection
+			&& frame.frameTime > m_spikeRatio * frame.medianFrameTime
+			&& frame.frameTime - frame.medianFrameTime > m_minSpikeTime;
+		if (!isSpike)
+		{
+			return;
+		}
+
+		std::string cause;
+		SpikeType type = classify(frame, cause);
+		m_spikesCount[(size_t)type]++;
+		if (type == SpikeType::System)
+		{
+			m_systemSpikesCount[cause]++;
+		}
+
+		LOG_INFO(
+			"Frame {} took {:.3f} ms against a {:.3f} ms median, spike type: {} {}",
+			frame.frameIndex,
+			1000.0f * frame.frameTime,
+			1000.0f * frame.medianFrameTime,
+			getSpikeTypeName(type),
+			cause
+		);
+
+		saveCapture(frame, type, cause);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void SpikeDetectorSystem::onStop()
+	{
+		stopWriter();
+		saveSummary();
+
+		EventsManager& eventsManager = GameController::get().getEventsManager();
+		eventsManager.unsubscribe<Events::RendererFrameStatsUpdate>(m_rendererStatsListenerId);
+		eventsManager.unsubscribe<Events::ModelLoaded>(m_modelLoadedListenerId);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	int SpikeDetectorSystem::getPriority() const
+	{
+		return -1;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	SpikeDetectorSystem::SpikeType SpikeDetectorSystem::classify(const FrameRecord& frame, std::string& cause) const
+	{
+		// a cause is only blamed when it accounts for a large share of the time the frame went over the median
+		float excessTime = frame.frameTime - frame.medianFrameTime;
+
+		if (frame.presentTime - frame.medianPresentTime > k_causeShare * excessTime)
+		{
+			cause = std::format("{:.3f} ms", 1000.0f * frame.presentTime);
+			return SpikeType::PresentStall;
+		}
+
+		// model loads happen inside the rendering system, so they are checked before the systems
+		if (frame.assetLoadTime > k_causeShare * excessTime)
+		{
+			cause = std::format("{} models in {:.3f} ms", frame.loadedModels, 1000.0f * frame.assetLoadTime);
+			return SpikeType::AssetLoad;
+		}
+
+		const SystemUpdateTime* slowestSystem = nullptr;
+		for (const SystemUpdateTime& system : frame.systems)
+		{
+			if (slowestSystem == nullptr || system.time - system.medianTime > slowestSystem->time - slowestSystem->medianTime)
+			{
+				slowestSystem = &system;
+			}
+		}
+
+		if (slowestSystem != nullptr && slowestSystem->time - slowestSystem->medianTime > k_causeShare * excessTime)
+		{
+			cause = slowestSystem->name;
+			return SpikeType::System;
+		}
+
+		cause.clear();
+		return SpikeType::Unknown;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void SpikeDetectorSystem::saveCapture(const FrameRecord& spikeFrame, SpikeType type, const std::string& cause)
+	{
+		if (m_capturePath.empty() || m_savedCaptures >= m_maxCaptures)
+		{
+			return;
+		}
+
+		size_t capturedFrames = std::min(m_framesCount, m_frames.size());
+
+		// only the frames are copied here, serializing and writing them is left to the writer thread
+		PendingCapture capture;
+		capture.capturePath = std::format("{}_{}.json", m_capturePath, m_savedCaptures);
+		capture.header["frame"] = spikeFrame.frameIndex;
+		capture.header["type"] = getSpikeTypeName(type);
+		capture.header["cause"] = cause;
+		capture.header["frameTime"] = spikeFrame.frameTime;
+		capture.header["medianFrameTime"] = spikeFrame.medianFrameTime;
+		capture.frames.reserve(capturedFrames);
+		for (size_t i = m_framesCount - capturedFrames; i < m_framesCount; i++)
+		{
+			capture.frames.push_back(m_frames[i % m_frames.size()]);
+		}
+		// the zones are copied here, the main thread's ring keeps being written while the writer serializes them
+		if (Utils::Profiler::get().isEnabled())
+		{
+			capture.tracePath = std::format("{}_{}_trace.json", m_capturePath, m_savedCaptures);
+			capture.trace = Utils::Profiler::get().snapshot(capture.frames.front().start);
+		}
+		m_savedCaptures++;
+
+		{
+			std::lock_guard<std::mutex> lock(m_writerMutex);
+			m_pendingCaptures.push_back(std::move(capture));
+		}
+		m_writerCondition.notify_one();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void SpikeDetectorSystem::startWriter()
+	{
+		if (m_writerThread.joinable())
+		{
+			return;
+		}
+
+		m_stopWriter = false;
+		m_writerThread = std::thread(&SpikeDetectorSystem::runWriter, this);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void SpikeDetectorSystem::stopWriter()
+	{
+		if (!m_writerThread.joinable())
+		{
+			return;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(m_writerMutex);
+			m_stopWriter = true;
+		}
+		m_writerCondition.notify_one();
+		m_writerThread.join();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void SpikeDetectorSystem::runWriter()
+	{
+		std::unique_lock<std::mutex> lock(m_writerMutex);
+		while (true)
+		{
+			m_writerCondition.wait(lock, [this]() { return m_stopWriter || !m_pendingCaptures.empty(); });
+			// the pending captures are still written when stopping, so none is lost on exit
+			if (m_pendingCaptures.empty())
+			{
+				return;
+			}
+
+			PendingCapture capture = std::move(m_pendingCaptures.front());
+			m_pendingCaptures.pop_front();
+			lock.unlock();
+			writeCapture(capture);
+			lock.lock();
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void SpikeDetectorSystem::writeCapture(PendingCapture& capture)
+	{
+		nlohmann::json& captureJson = capture.header;
+
+		if (!capture.tracePath.empty())
+		{
+			bool traceSaved = Utils::Profiler::get().saveChromeTrace(capture.tracePath, capture.trace);
+			ASSERT(traceSaved, "Failed to save spike trace {}", capture.tracePath);
+			if (traceSaved)
+			{
+				captureJson["trace"] = capture.tracePath;
+			}
+		}
+
+		nlohmann::json frames = nlohmann::json::array();
+		for (const FrameRecord& frame : capture.frames)
+		{
+			frames.push_back(toJson(frame));
+		}
+		captureJson["frames"] = frames;
+
+		std::ofstream outFile(capture.capturePath);
+		ASSERT(outFile.is_open(), "Failed to open spike capture file {}", capture.capturePath);
+		if (!outFile.is_open())
+		{
+			return;
+		}
+
+		outFile << captureJson.dump(4);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void SpikeDetectorSystem::saveSummary() const
+	{
+		nlohmann::json summary;
+		summary["frames"] = m_framesCount;
+		summary["savedCaptures"] = m_savedCaptures;
+		size_t spikesCount = 0;
+		for (size_t i = 0; i < m_spikesCount.size(); i++)
+		{
+			summary["spikes"][getSpikeTypeName((SpikeType)i)] = m_spikesCount[i];
+			spikesCount += m_spikesCount[i];
+		}
+		summary["systemSpikes"] = nlohmann::json::object();
+		for (const auto& [name, count] : m_systemSpikesCount)
+		{
+			summary["systemSpikes"][name] = count;
+		}
+
+		std::cout << std::format("Detected {} frame spikes in {} frames", spikesCount, m_framesCount) << std::endl;
+
+		if (m_capturePath.empty())
+		{
+			return;
+		}
+
+		std::string summaryPath = m_capturePath + "_summary.json";
+		std::ofstream outFile(summaryPath);
+		ASSERT(outFile.is_open(), "Failed to open spike summary file {}", summaryPath);
+		if (!outFile.is_open())
+		{
+			return;
+		}
+
+		outFile << summary.dump(4);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	nlohmann::json SpikeDetectorSystem::toJson(const FrameRecord& frame)
+	{
+		nlohmann::json frameJson;
+		frameJson["frame"] = frame.frameIndex;
+		frameJson["frameTime"] = frame.frameTime;
+		frameJson["medianFrameTime"] = frame.medianFrameTime;
+		frameJson["presentTime"] = frame.presentTime;
+		frameJson["allocations"] = frame.allocations;
+		frameJson["loadedModels"] = frame.loadedModels;
+		frameJson["assetLoadTime"] = frame.assetLoadTime;
+
+		const Visual::RendererFrameStats& stats = frame.rendererStats;
+		frameJson["renderer"] = {
+			{ "drawCalls", stats.drawCalls },
+			{ "triangles", stats.triangles },
+			{ "vertices", stats.vertices },
+			{ "indices", stats.indices },
+			{ "pipelineBinds", stats.pipelineBinds },
+			{ "bufferBinds", stats.bufferBinds },
+			{ "resourceBinds", stats.resourceBinds },
+			{ "uniformUpdates", stats.uniformUpdates },
+			{ "uploadedBytes", stats.uploadedBytes }
+		};
+
+		frameJson["systems"] = nlohmann::json::object();
+		for (const SystemUpdateTime& system : frame.systems)
+		{
+			frameJson["systems"][system.name] = system.time;
+		}
+		return frameJson;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	const char* SpikeDetectorSystem::getSpikeTypeName(SpikeType type)
+	{
+		switch (type)
+		{
+		case SpikeType::System:
+			return "System";
+		case SpikeType::AssetLoad:
+			return "AssetLoad";
+		case SpikeType::PresentStall:
+			return "PresentStall";
+		default:
+			return "Unknown";
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+}
\ No newline at end of file
@@ -0,0 +1,111 @@
+#pragma once
+
+#include "ISystem.h"
+
+#include <array>
+#include <string>
+#include <vector>
+#include <deque>
+#include <unordered_map>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include "Managers/EventsManager.h"
+#include "Events/StatsEvents.h"
+#include "Utils/RollingHistogram.h"
+#include "Utils/Profiler.h"
+
+namespace Engine::Systems
+{
+	// Compares every frame against the rolling median frame time and, when a frame spikes,
+	// saves the frames leading up to it together with what the engine was doing during them.
+	class SpikeDetectorSystem: public ISystem
+	{
+	public:
+		void onStart() override;
+		void onUpdate(float dt) override;
+		void onStop() override;
+		int getPriority() const override;
+
+	private:
+		enum class SpikeType
+		{
+			System,
+			AssetLoad,
+			PresentStall,
+			Unknown,
+			Count
+		};
+
+		struct FrameRecord
+		{
+			size_t frameIndex;
+			float frameTime;
+			float medianFrameTime;
+			float presentTime;
+			float medianPresentTime;
+			uint64_t allocations;
+			size_t loadedModels;
+			float assetLoadTime;
+			Utils::Profiler::Clock::time_point start;
+			Visual::RendererFrameStats rendererStats;
+			std::vector<SystemUpdateTime> systems;
+		};
+
+		struct PendingCapture
+		{
+			std::string capturePath;
+			std::string tracePath;
+			nlohmann::json header;
+			std::vector<FrameRecord> frames;
+			Utils::Profiler::Snapshot trace;
+		};
+
+	private:
+		SpikeType classify(const FrameRecord& frame, std::string& cause) const;
+		void saveCapture(const FrameRecord& spikeFrame, SpikeType type, const std::string& cause);
+		void startWriter();
+		void stopWriter();
+		void runWriter();
+		static void writeCapture(PendingCapture& capture);
+		void saveSummary() const;
+		static nlohmann::json toJson(const FrameRecord& frame);
+		static const char* getSpikeTypeName(SpikeType type);
+
+	private:
+		static constexpr size_t k_medianWindow = 120;
+		static constexpr size_t k_minFramesForDetection = 30;
+		static constexpr float k_causeShare = 0.5f;
+
+		float m_spikeRatio = 2.0f;
+		float m_minSpikeTime = 0.002f;
+		size_t m_maxCaptures = 16;
+		std::string m_capturePath;
+
+		Utils::RollingHistogram m_frameTimes{ k_medianWindow };
+		Utils::RollingHistogram m_presentTimes{ k_medianWindow };
+		std::vector<FrameRecord> m_frames;
+		size_t m_framesCount = 0;
+
+		std::array<size_t, (size_t)SpikeType::Count> m_spikesCount{};
+		std::unordered_map<std::string, size_t> m_systemSpikesCount;
+		size_t m_savedCaptures = 0;
+
+		// captures are serialized and written off the main thread, so saving one doesn't stall the frame after the spike
+		std::thread m_writerThread;
+		std::mutex m_writerMutex;
+		std::condition_variable m_writerCondition;
+		std::deque<PendingCapture> m_pendingCaptures;
+		bool m_stopWriter = false;
+
+		// gathered from events while the frame that is measured next is running
+		size_t m_loadedModels = 0;
+		float m_assetLoadTime = 0.0f;
+		float m_presentTime = 0.0f;
+		Visual::RendererFrameStats m_rendererStats;
+
+		EventListenerID m_rendererStatsListenerId = -1;
+		EventListenerID m_modelLoadedListenerId = -1;
+	};
+}
\ No newline at end of file
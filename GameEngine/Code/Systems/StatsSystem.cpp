@@ -2,9 +2,13 @@
 
 #include <iostream>
 #include <fstream>
-#include <psapi.h>
+#include <filesystem>
+#include <format>
 
 #include "Utils/DebugMacros.h"
+#include "Utils/AllocationTracker.h"
+#include "Utils/TelemetryRing.h"
+#include "Utils/BasicUtils.h"
 #include "Managers/GameController.h"
 #include "Events/NativeInputEvents.h"
 #include "Events/StatsEvents.h"
@@ -30,33 +34,16 @@ namespace Engine::Systems
 		EventsManager& eventsManager = GameController::get().getEventsManager();
 		m_recordingUpdateListenerId = eventsManager.subscribe<Events::StatsRecordingUpdate>([this](const Events::StatsRecordingUpdate& update) {onRecordingStateChanged(update.rendererName, update.recordData);});
 		m_outputFileUpdateListenerId = eventsManager.subscribe<Events::StatsOutputFileUpdate>([this](const Events::StatsOutputFileUpdate& update) {m_outputPath = update.outputPath;});
+		m_rendererStatsListenerId = eventsManager.subscribe<Events::RendererFrameStatsUpdate>([this](const Events::RendererFrameStatsUpdate& update) {m_lastRendererStats = update.stats;});
 
 		m_firstUpdate = true;
-		PDH_STATUS cpuOpenRes = PdhOpenQuery(nullptr, 0, &m_cpuQuery);
-		ASSERT(cpuOpenRes == ERROR_SUCCESS, "Failed to open CPU query");
-		PDH_STATUS cpuAddRes = PdhAddCounter(m_cpuQuery, TEXT("\\Processor(_Total)\\% Processor Time"), 0, &m_cpuUsageCounter);
-		ASSERT(cpuAddRes == ERROR_SUCCESS, "Failed to add CPU counter");
-
-		PDH_STATUS cpuCollectRes = PdhCollectQueryData(m_cpuQuery);
-		ASSERT(cpuCollectRes == ERROR_SUCCESS, "Failed to collect CPU query data");
-
-		PDH_STATUS gpuOpenRes = PdhOpenQuery(nullptr, 0, &m_gpuUsageQuery);
-		ASSERT(gpuOpenRes == ERROR_SUCCESS, "Failed to open GPU query");
-		PDH_STATUS gpuAddRes = PdhAddCounter(m_gpuUsageQuery, TEXT("\\GPU Engine(*_3D)\\Utilization Percentage"), 0, &m_gpuUsageCounter);
-		ASSERT(gpuAddRes == ERROR_SUCCESS, "Failed to add GPU counter");
-
-		PDH_STATUS gpuCollectRes = PdhCollectQueryData(m_gpuUsageQuery);
-		ASSERT(gpuCollectRes == ERROR_SUCCESS, "Failed to collect GPU query data");
-
-		PDH_STATUS gpuMemoryOpenRes = PdhOpenQuery(nullptr, 0, &m_gpuMemoryUsageQuery);
-		ASSERT(gpuMemoryOpenRes == ERROR_SUCCESS, "Failed to open GPU query");
-		PDH_STATUS gpuAddMemoryRes = PdhAddCounter(m_gpuMemoryUsageQuery, TEXT("\\GPU Process Memory(*)\\Dedicated Usage"), 0, &m_gpuMemoryUsageCounter);
-		ASSERT(gpuAddMemoryRes == ERROR_SUCCESS, "Failed to add GPU counter");
-
-		PDH_STATUS gpuMemoryCollectRes = PdhCollectQueryData(m_gpuMemoryUsageQuery);
-		ASSERT(gpuMemoryCollectRes == ERROR_SUCCESS, "Failed to collect GPU query data");
-
-		Sleep(k_initialSleepTime * 1000);
+		m_metricsProvider = Utils::IMetricsProvider::create();
+		bool metricsOpened = m_metricsProvider != nullptr && m_metricsProvider->open();
+		ASSERT(metricsOpened, "Failed to open the metrics provider");
+		if (!metricsOpened)
+		{
+			m_metricsProvider.reset();
+		}
 	}
 
 	//////////////////////////////////////////////////////////////////////////
@@ -65,122 +52,65 @@ namespace Engine::Systems
 	{
 		if (m_firstUpdate)
 		{
-			m_creationTime = dt - k_initialSleepTime;
+			m_creationTime = dt;
 			m_firstUpdate = false;
 			m_timePassed = 0.0f;
+			m_lastCounters = Utils::HardwareCounters::get().read();
+			startSampler();
 			return;
 		}
 
-		if (m_recordData)
-		{
-			m_frameTimes.push_back(dt);
-		}
-
-		m_frameTimeChunk.push_back(dt);
+		// the main thread counters between two updates of this system cover exactly one frame
+		Utils::HardwareCounters::Reading counters = Utils::HardwareCounters::get().read();
+		Utils::HardwareCounters::Values frameCounters = counters - m_lastCounters;
+		m_lastCounters = counters;
 
-		m_timePassed += dt;
-		if (m_timePassed > k_timeBetweenSamples)
+		std::optional<float> pacingError = GameController::get().getFrameLimiter().getLastPacingError();
+		uint64_t allocations = Utils::AllocationTracker::get().getLastFrameAllocations();
+		FrameSample sample{ dt, pacingError.value_or(0.0f), pacingError.has_value(), allocations, frameCounters, m_lastRendererStats };
+		sample.frameIndex = m_framesCount++;
+		sample.systemsCount = 0;
+		if (m_recordData)
 		{
-			m_timePassed = 0.0f;
-
-			float cpuUsage = 0.0f;
-			PDH_STATUS res = PdhCollectQueryData(m_cpuQuery);
-			ASSERT(res == ERROR_SUCCESS, "Failed to collect CPU query data");
-			if (res == ERROR_SUCCESS)
+			// the systems updated after this one report their time from the previous frame
+			GameController::get().getSystemsManager().getLastUpdateTimes(m_systemTimes);
+			for (size_t i = 0; i < m_systemTimes.size() && i < m_frameSeriesSystems.size(); i++)
 			{
-				PDH_FMT_COUNTERVALUE cpuCounterVal;
-				res = PdhGetFormattedCounterValue(m_cpuUsageCounter, PDH_FMT_DOUBLE, nullptr, &cpuCounterVal);
-				ASSERT(res == ERROR_SUCCESS, "Failed to format CPU query data");
-				if (res == ERROR_SUCCESS)
+				// a full queue leaves the remaining systems of the frame empty
+				if (!m_systemTimeSamples.push({ (uint32_t)sample.frameIndex, (uint32_t)i, m_systemTimes[i] }))
 				{
-					cpuUsage = (float)cpuCounterVal.doubleValue;
-					if (m_recordData)
-					{
-						m_cpuUsage.push_back(cpuUsage);
-					}
+					break;
 				}
+				sample.systemsCount++;
 			}
-
-			float gpuUsage = 0.0f;
-			res = PdhCollectQueryData(m_gpuUsageQuery);
-			ASSERT(res == ERROR_SUCCESS, "Failed to collect GPU query data");
-			if (res == ERROR_SUCCESS)
-			{
-				PDH_FMT_COUNTERVALUE gpuLoadCounterVal;
-				res = PdhGetFormattedCounterValue(m_gpuUsageCounter, PDH_FMT_DOUBLE, nullptr, &gpuLoadCounterVal);
-				ASSERT(res == ERROR_SUCCESS, "Failed to format GPU query data");
-				if (res == ERROR_SUCCESS)
-				{
-					gpuUsage = (float)gpuLoadCounterVal.doubleValue;
-					if (m_recordData)
-					{
-						m_gpuUsage.push_back(gpuUsage);
-					}
-				}
-			}
-
-			float gpuMemoryUsage = 0.0f;
-			res = PdhCollectQueryData(m_gpuMemoryUsageQuery);
-			ASSERT(res == ERROR_SUCCESS, "Failed to collect GPU query data");
-			if (res == ERROR_SUCCESS)
-			{
-				PDH_FMT_COUNTERVALUE gpuMemoryLoadCounterVal;
-				res = PdhGetFormattedCounterValue(m_gpuMemoryUsageCounter, PDH_FMT_DOUBLE, nullptr, &gpuMemoryLoadCounterVal);
-				ASSERT(res == ERROR_SUCCESS, "Failed to format GPU query data");
-				if (res == ERROR_SUCCESS)
-				{
-					gpuMemoryUsage = (float)gpuMemoryLoadCounterVal.doubleValue / (1024.0 * 1024.0);
-					if (m_recordData)
-					{
-						m_gpuMemoryUsage.push_back(gpuMemoryUsage);
-					}
-				}
-			}
-
-			float memoryUsage = 0.0f;
-			PROCESS_MEMORY_COUNTERS memCounter;
-			if (GetProcessMemoryInfo(GetCurrentProcess(), &memCounter, sizeof(memCounter)))
-			{
-				memoryUsage = memCounter.WorkingSetSize / (1024.0 * 1024.0);
-				if (m_recordData)
-				{
-					m_memoryUsage.push_back(memoryUsage);
-				}
-			}
-
-			StatsData statsData{};
-			statsData.cpuUsage = cpuUsage;
-			statsData.gpuUsage = gpuUsage;
-			statsData.memoryUsage = memoryUsage;
-			statsData.gpuMemoryUsage = gpuMemoryUsage;
-			statsData.avgFrameTime = std::accumulate(m_frameTimeChunk.begin(), m_frameTimeChunk.end(), 0.0) / m_frameTimeChunk.size();
-			statsData.avgFPS = 1.0f / statsData.avgFrameTime;
-
-			std::sort(m_frameTimeChunk.begin(), m_frameTimeChunk.end());
-			size_t onePercent = m_frameTimeChunk.size() / 100;
-			float percentile99 = onePercent > 0 ? m_frameTimeChunk[m_frameTimeChunk.size() - onePercent] : m_frameTimeChunk.back();
-			statsData.frameTimePercentile99 = percentile99;
-
-			m_frameTimeChunk.clear();
-			GameController::get().getEventsManager().emit<Events::StatsUpdate>(Events::StatsUpdate{ statsData });
-
+		}
+		publishTelemetry(sample);
+		if (!m_frameSamples.push(sample))
+		{
+			m_droppedFrameSamples++;
 		}
 
+		publishSystemsTiming(dt);
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 
 	void StatsSystem::onStop()
 	{
-		PdhCloseQuery(m_gpuUsageQuery);
-		PdhCloseQuery(m_cpuQuery);
-		PdhCloseQuery(m_gpuMemoryUsageQuery);
+		stopSampler();
+
+		if (m_metricsProvider)
+		{
+			m_metricsProvider->close();
+			m_metricsProvider.reset();
+		}
 
 		saveRecordedData();
 
 		EventsManager& eventsManager = GameController::get().getEventsManager();
 		eventsManager.unsubscribe<Events::StatsRecordingUpdate>(m_recordingUpdateListenerId);
 		eventsManager.unsubscribe<Events::StatsOutputFileUpdate>(m_outputFileUpdateListenerId);
+		eventsManager.unsubscribe<Events::RendererFrameStatsUpdate>(m_rendererStatsListenerId);
 	}
 
 	//////////////////////////////////////////////////////////////////////////
@@ -199,7 +129,9 @@ namespace Engine::Systems
 			return;
 		}
 
-		if (m_frameTimes.empty() || m_cpuUsage.empty() || m_gpuUsage.empty() || m_memoryUsage.empty() || m_gpuMemoryUsage.empty())
+		m_frameSeries.close();
+
+		if (m_frameTimes.getCount() == 0)
 		{
 			GameController::get().getEventsManager().emit<Events::SendWarning>(Events::SendWarning{ "No data to save. Please record some data first." });
 			return;
@@ -209,28 +141,11 @@ namespace Engine::Systems
 		auto& compManager = gameController.getComponentsManager();
 		auto const& models = compManager.getComponentSet<Components::Model>();
 		size_t objectsCount = models.size();
-		size_t totalNumberOfVertices = 0;
-
-		std::sort(m_frameTimes.begin(), m_frameTimes.end());
-		float medianFrameTime = m_frameTimes[m_frameTimes.size() / 2];
-		float averageFrameTime = std::accumulate(m_frameTimes.begin(), m_frameTimes.end(), 0.0f) / m_frameTimes.size();
-
-		size_t onePercent = m_frameTimes.size() / 100;
-		float percentile99 = onePercent > 0 ? m_frameTimes[m_frameTimes.size() - onePercent] : m_frameTimes.back();
-		float percentile1 = m_frameTimes[onePercent];
-
-		float averageCPUUsage = std::accumulate(m_cpuUsage.begin(), m_cpuUsage.end(), 0.0) / m_cpuUsage.size();
-		float maxCpuUsage = *std::max_element(m_cpuUsage.begin(), m_cpuUsage.end());
-		float minCpuUsage = *std::min_element(m_cpuUsage.begin(), m_cpuUsage.end());
-		float averageGPUUsage = std::accumulate(m_gpuUsage.begin(), m_gpuUsage.end(), 0.0) / m_gpuUsage.size();
-		float maxGpuUsage = *std::max_element(m_gpuUsage.begin(), m_gpuUsage.end());
-		float minGpuUsage = *std::min_element(m_gpuUsage.begin(), m_gpuUsage.end());
-		float averageMemoryUsage = std::accumulate(m_memoryUsage.begin(), m_memoryUsage.end(), 0.0) / m_memoryUsage.size();
-		float maxMemoryUsage = *std::max_element(m_memoryUsage.begin(), m_memoryUsage.end());
-		float minMemoryUsage = *std::min_element(m_memoryUsage.begin(), m_memoryUsage.end());
-		float averageGpuMemoryUsage = std::accumulate(m_gpuMemoryUsage.begin(), m_gpuMemoryUsage.end(), 0.0) / m_gpuMemoryUsage.size();
-		float maxGpuMemoryUsage = *std::max_element(m_gpuMemoryUsage.begin(), m_gpuMemoryUsage.end());
-		float minGpuMemoryUsage = *std::min_element(m_gpuMemoryUsage.begin(), m_gpuMemoryUsage.end());
+		double verticesPerFrame = (double)m_recordedRendererStats.vertices / m_frameTimes.getCount();
+		float averageFrameTime = m_frameTimes.getMean();
+
+		float targetFPS = gameController.getFrameLimiter().getTargetFPS();
+		const Utils::StartupTimeline& startupTimeline = gameController.getStartupTimeline();
 
 		std::ofstream outFile(m_outputPath);
 		if (!outFile.is_open())
@@ -241,24 +156,491 @@ namespace Engine::Systems
 		outFile << "Renderer: " << m_rendererName << std::endl;
 		outFile << "Objects count: " << objectsCount << std::endl;
 		outFile << "Creation time: " << m_creationTime << std::endl;
-		outFile << "Average CPU usage: " << averageCPUUsage << std::endl;
-		outFile << "Max CPU usage: " << maxCpuUsage << std::endl;
-		outFile << "Min CPU usage: " << minCpuUsage << std::endl;
-		outFile << "Average GPU usage: " << averageGPUUsage << std::endl;
-		outFile << "Max GPU usage: " << maxGpuUsage << std::endl;
-		outFile << "Min GPU usage: " << minGpuUsage << std::endl;
-		outFile << "Average memory usage: " << averageMemoryUsage << std::endl;
-		outFile << "Max memory usage: " << maxMemoryUsage << std::endl;
-		outFile << "Min memory usage: " << minMemoryUsage << std::endl;
-		outFile << "Average GPU memory usage: " << averageGpuMemoryUsage << std::endl;
-		outFile << "Max GPU memory usage: " << maxGpuMemoryUsage << std::endl;
-		outFile << "Min GPU memory usage: " << minGpuMemoryUsage << std::endl;
+		// a platform without a counter leaves its vector empty and its lines out of the file
+		saveUsage(outFile, "CPU usage", m_cpuUsage);
+		saveUsage(outFile, "GPU usage", m_gpuUsage);
+		saveUsage(outFile, "memory usage", m_memoryUsage);
+		saveUsage(outFile, "GPU memory usage", m_gpuMemoryUsage);
 		outFile << "Average FPS: " << 1.0f / averageFrameTime << std::endl;
 		outFile << "Average frame time: " << averageFrameTime << std::endl;
-		outFile << "Median frame time: " << medianFrameTime << std::endl;
-		outFile << "99th percentile frame time: " << percentile99 << std::endl;
-		outFile << "1th percentile frame time: " << percentile1 << std::endl;
+		outFile << "Median frame time: " << m_frameTimes.getPercentile(50.0f) << std::endl;
+		outFile << "90th percentile frame time: " << m_frameTimes.getPercentile(90.0f) << std::endl;
+		outFile << "99th percentile frame time: " << m_frameTimes.getPercentile(99.0f) << std::endl;
+		outFile << "99.9th percentile frame time: " << m_frameTimes.getPercentile(99.9f) << std::endl;
+		outFile << "1th percentile frame time: " << m_frameTimes.getPercentile(1.0f) << std::endl;
+		outFile << "Max frame time: " << m_frameTimes.getMax() << std::endl;
+		outFile << "Min frame time: " << m_frameTimes.getMin() << std::endl;
+		outFile << "Target FPS: " << targetFPS << std::endl;
+		outFile << "Median pacing error: " << m_pacingErrors.getPercentile(50.0f) << std::endl;
+		outFile << "99th percentile pacing error: " << m_pacingErrors.getPercentile(99.0f) << std::endl;
+		outFile << "Dropped frame samples: " << m_droppedFrameSamples << std::endl;
+		outFile << "Dropped events: " << gameController.getEventsManager().getDroppedEventsCount() << std::endl;
+		outFile << "Time to first frame: " << startupTimeline.getTimeToFirstFrame() << std::endl;
+		for (const Utils::StartupTimeline::Phase& phase : startupTimeline.getPhases())
+		{
+			outFile << "Startup " << phase.category << " " << phase.name << ": " << phase.duration << std::endl;
+		}
+		for (const SystemTimingStats& timing : gameController.getSystemsManager().getRecordedTimings())
+		{
+			outFile << "System " << timing.name << " mean update time: " << timing.meanTime << std::endl;
+			outFile << "System " << timing.name << " 99th percentile update time: " << timing.percentile99Time << std::endl;
+			outFile << "System " << timing.name << " max update time: " << timing.maxTime << std::endl;
+			outFile << "System " << timing.name << " budget: " << timing.budget << std::endl;
+			outFile << "System " << timing.name << " budget overruns: " << timing.budgetOverruns << std::endl;
+		}
+
+		if (Utils::AllocationTracker::isEnabled() && m_recordedAllocationFrames > 0)
+		{
+			const Utils::AllocationTracker& allocationTracker = Utils::AllocationTracker::get();
+			outFile << "Average allocations per frame: " << (float)m_recordedAllocations / m_recordedAllocationFrames << std::endl;
+			outFile << "Max allocations per frame: " << m_maxFrameAllocations << std::endl;
+			outFile << "Peak allocated bytes per frame: " << allocationTracker.getPeakFrameBytes() << std::endl;
+			outFile << "Peak live heap bytes: " << allocationTracker.getPeakLiveBytes() << std::endl;
+			// the tag and thread counters run since startup, only the recorded part is written
+			for (const Utils::AllocationTracker::Usage& usage : Utils::AllocationTracker::getUsageSince(allocationTracker.getTagUsage(), m_recordingStartTagUsage))
+			{
+				outFile << "Allocations " << usage.name << ": " << usage.allocations << std::endl;
+				outFile << "Allocated bytes " << usage.name << ": " << usage.bytes << std::endl;
+			}
+			for (const Utils::AllocationTracker::Usage& usage : Utils::AllocationTracker::getUsageSince(allocationTracker.getThreadUsage(), m_recordingStartThreadUsage))
+			{
+				outFile << "Allocations " << usage.name << ": " << usage.allocations << std::endl;
+				outFile << "Allocated bytes " << usage.name << ": " << usage.bytes << std::endl;
+			}
+		}
+
+		saveHardwareCounters(outFile);
+		saveRendererStats(outFile, averageFrameTime);
+		saveProcessMetrics(outFile);
+
+		saveJsonSummary(objectsCount, verticesPerFrame);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void StatsSystem::saveJsonSummary(size_t objectsCount, double verticesPerFrame) const
+	{
+		// the same data as the text file in a form that doesn't have to be parsed back line by line
+		GameController& gameController = GameController::get();
+		std::string configPath = gameController.getConfigPath();
+		std::string config = Utils::readFile(configPath);
+
+		// FNV-1a, enough to tell apart runs made with different configs
+		uint64_t configHash = 14695981039346656037ull;
+		for (char c : config)
+		{
+			configHash = (configHash ^ (uint8_t)c) * 1099511628211ull;
+		}
+
+		nlohmann::json summary;
+		summary["schemaVersion"] = k_summarySchemaVersion;
+		summary["build"] = getBuildInfo();
+		summary["config"]["path"] = configPath;
+		summary["config"]["hash"] = std::format("{:016x}", configHash);
+		summary["renderer"] = m_rendererName;
+		summary["frameSeries"] = std::filesystem::path(getOutputPath(k_frameSeriesExtension)).filename().string();
+		summary["objectsCount"] = objectsCount;
+		summary["verticesPerFrame"] = verticesPerFrame;
+		summary["creationTime"] = m_creationTime;
+		summary["targetFPS"] = gameController.getFrameLimiter().getTargetFPS();
+		summary["droppedFrameSamples"] = m_droppedFrameSamples;
+
+		nlohmann::json& frameTime = summary["frameTime"];
+		frameTime["count"] = m_frameTimes.getCount();
+		frameTime["mean"] = m_frameTimes.getMean();
+		frameTime["min"] = m_frameTimes.getMin();
+		frameTime["max"] = m_frameTimes.getMax();
+		frameTime["p1"] = m_frameTimes.getPercentile(1.0f);
+		frameTime["p50"] = m_frameTimes.getPercentile(50.0f);
+		frameTime["p90"] = m_frameTimes.getPercentile(90.0f);
+		frameTime["p99"] = m_frameTimes.getPercentile(99.0f);
+		frameTime["p99.9"] = m_frameTimes.getPercentile(99.9f);
+
+		summary["pacingError"]["p50"] = m_pacingErrors.getPercentile(50.0f);
+		summary["pacingError"]["p99"] = m_pacingErrors.getPercentile(99.0f);
+
+		summary["cpuUsage"] = getUsageJson(m_cpuUsage);
+		summary["gpuUsage"] = getUsageJson(m_gpuUsage);
+		summary["memoryUsage"] = getUsageJson(m_memoryUsage);
+		summary["gpuMemoryUsage"] = getUsageJson(m_gpuMemoryUsage);
+		summary["processCpuUsage"] = getUsageJson(m_processCpuUsage);
+		summary["mainThreadCpuUsage"] = getUsageJson(m_mainThreadCpuUsage);
+		summary["workerThreadsCpuUsage"] = getUsageJson(m_workerThreadsCpuUsage);
+
+		Visual::RendererFrameStats averageStats = m_recordedRendererStats / m_frameTimes.getCount();
+		nlohmann::json& rendererStats = summary["rendererStatsPerFrame"];
+		rendererStats["drawCalls"] = averageStats.drawCalls;
+		rendererStats["triangles"] = averageStats.triangles;
+		rendererStats["vertices"] = averageStats.vertices;
+		rendererStats["indices"] = averageStats.indices;
+		rendererStats["pipelineBinds"] = averageStats.pipelineBinds;
+		rendererStats["bufferBinds"] = averageStats.bufferBinds;
+		rendererStats["resourceBinds"] = averageStats.resourceBinds;
+		rendererStats["uniformUpdates"] = averageStats.uniformUpdates;
+		rendererStats["uploadedBytes"] = averageStats.uploadedBytes;
+		if (m_recordedRendererStats.gpuTimedFrames > 0)
+		{
+			rendererStats["gpuFrameTime"] = 1e-9 * averageStats.gpuFrameTime;
+			rendererStats["gpuScenePassTime"] = 1e-9 * averageStats.gpuScenePassTime;
+			rendererStats["gpuUIPassTime"] = 1e-9 * averageStats.gpuUIPassTime;
+			rendererStats["gpuUploadTime"] = 1e-9 * averageStats.gpuUploadTime;
+		}
 
+		const Utils::HardwareCounters& hardwareCounters = Utils::HardwareCounters::get();
+		summary["hardwareCountersPerFrame"] = nlohmann::json::object();
+		for (size_t i = 0; i < Utils::HardwareCounters::k_countersCount; i++)
+		{
+			Utils::HardwareCounters::Counter counter = (Utils::HardwareCounters::Counter)i;
+			if (hardwareCounters.isAvailable() && hardwareCounters.isCounterAvailable(counter))
+			{
+				summary["hardwareCountersPerFrame"][Utils::HardwareCounters::getCounterName(counter)] = (double)m_recordedCounters[counter] / m_frameTimes.getCount();
+			}
+		}
+
+		summary["systems"] = nlohmann::json::array();
+		for (const SystemTimingStats& timing : gameController.getSystemsManager().getRecordedTimings())
+		{
+			nlohmann::json system;
+			system["name"] = timing.name;
+			system["meanTime"] = timing.meanTime;
+			system["p99Time"] = timing.percentile99Time;
+			system["maxTime"] = timing.maxTime;
+			system["budget"] = timing.budget;
+			system["budgetOverruns"] = timing.budgetOverruns;
+			system["updatesCount"] = timing.updatesCount;
+			summary["systems"].push_back(system);
+		}
+
+		summary["startup"] = gameController.getStartupTimeline().toJson();
+
+		std::ofstream outFile(getOutputPath(k_summaryExtension));
+		if (!outFile.is_open())
+		{
+			return;
+		}
+		outFile << summary.dump(4);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	nlohmann::json StatsSystem::getBuildInfo()
+	{
+		nlohmann::json build;
+		build["date"] = __DATE__;
+		build["time"] = __TIME__;
+#ifdef _MSC_VER
+		build["compiler"] = std::format("MSVC {}", _MSC_FULL_VER);
+#elif defined(__GNUC__)
+		build["compiler"] = std::format("GCC {}.{}.{}", __GNUC__, __GNUC_MINOR__, __GNUC_PATCHLEVEL__);
+#endif
+#ifdef _WIN32
+		build["platform"] = "Windows";
+#else
+		build["platform"] = "Linux";
+#endif
+#ifdef _DEBUG
+		build["configuration"] = "Debug";
+#else
+		build["configuration"] = "Release";
+#endif
+		build["defines"] = nlohmann::json::array();
+#ifdef _PROFILE
+		build["defines"].push_back("_PROFILE");
+#endif
+#ifdef _TRACK_ALLOCATIONS
+		build["defines"].push_back("_TRACK_ALLOCATIONS");
+#endif
+#ifdef _BATCH_OPENGL_ERRORS
+		build["defines"].push_back("_BATCH_OPENGL_ERRORS");
+#endif
+		return build;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	nlohmann::json StatsSystem::getUsageJson(const std::vector<float>& usage)
+	{
+		if (usage.empty())
+		{
+			return nullptr;
+		}
+
+		nlohmann::json usageJson;
+		usageJson["mean"] = std::accumulate(usage.begin(), usage.end(), 0.0) / usage.size();
+		usageJson["min"] = *std::min_element(usage.begin(), usage.end());
+		usageJson["max"] = *std::max_element(usage.begin(), usage.end());
+		return usageJson;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void StatsSystem::openFrameSeries()
+	{
+		// without a file no system times are queued
+		m_frameSeriesSystems.clear();
+		if (!m_frameSeries.open(getOutputPath(k_frameSeriesExtension)))
+		{
+			return;
+		}
+
+		// the system columns follow the systems present when the recording started
+		m_frameSeriesSystems = GameController::get().getSystemsManager().getSystemNames();
+		m_frameSeriesSystemTimes.resize(m_frameSeriesSystems.size());
+
+		m_frameSeries.addField("frame");
+		m_frameSeries.addField("frameTime");
+		m_frameSeries.addField("pacingError");
+		m_frameSeries.addField("allocations");
+		for (const std::string& system : m_frameSeriesSystems)
+		{
+			m_frameSeries.addField("system " + system);
+		}
+		m_frameSeries.addField("drawCalls");
+		m_frameSeries.addField("triangles");
+		m_frameSeries.addField("vertices");
+		m_frameSeries.addField("indices");
+		m_frameSeries.addField("pipelineBinds");
+		m_frameSeries.addField("bufferBinds");
+		m_frameSeries.addField("resourceBinds");
+		m_frameSeries.addField("uniformUpdates");
+		m_frameSeries.addField("uploadedBytes");
+		m_frameSeries.addField("gpuFrameTime");
+		m_frameSeries.addField("gpuScenePassTime");
+		m_frameSeries.addField("gpuUIPassTime");
+		m_frameSeries.addField("gpuUploadTime");
+		for (size_t i = 0; i < Utils::HardwareCounters::k_countersCount; i++)
+		{
+			m_frameSeries.addField(Utils::HardwareCounters::getCounterName((Utils::HardwareCounters::Counter)i));
+		}
+		m_frameSeries.endRow();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void StatsSystem::writeFrameSeries(const FrameSample& sample)
+	{
+		if (!m_frameSeries.isOpen())
+		{
+			return;
+		}
+
+		m_frameSeries.addField(sample.frameIndex);
+		m_frameSeries.addField(sample.frameTime);
+		if (sample.hasPacingError)
+		{
+			m_frameSeries.addField(sample.pacingError);
+		}
+		else
+		{
+			m_frameSeries.addEmptyField();
+		}
+		m_frameSeries.addField(sample.allocations);
+
+		for (float systemTime : m_frameSeriesSystemTimes)
+		{
+			if (systemTime >= 0.0f)
+			{
+				m_frameSeries.addField(systemTime);
+			}
+			else
+			{
+				m_frameSeries.addEmptyField();
+			}
+		}
+
+		const Visual::RendererFrameStats& stats = sample.rendererStats;
+		m_frameSeries.addField(stats.drawCalls);
+		m_frameSeries.addField(stats.triangles);
+		m_frameSeries.addField(stats.vertices);
+		m_frameSeries.addField(stats.indices);
+		m_frameSeries.addField(stats.pipelineBinds);
+		m_frameSeries.addField(stats.bufferBinds);
+		m_frameSeries.addField(stats.resourceBinds);
+		m_frameSeries.addField(stats.uniformUpdates);
+		m_frameSeries.addField(stats.uploadedBytes);
+
+		// GPU times in seconds, empty for frames whose queries weren't resolved
+		if (stats.gpuTimedFrames > 0)
+		{
+			m_frameSeries.addField(1e-9 * stats.gpuFrameTime);
+			m_frameSeries.addField(1e-9 * stats.gpuScenePassTime);
+			m_frameSeries.addField(1e-9 * stats.gpuUIPassTime);
+			m_frameSeries.addField(1e-9 * stats.gpuUploadTime);
+		}
+		else
+		{
+			for (size_t i = 0; i < 4; i++)
+			{
+				m_frameSeries.addEmptyField();
+			}
+		}
+
+		const Utils::HardwareCounters& hardwareCounters = Utils::HardwareCounters::get();
+		for (size_t i = 0; i < Utils::HardwareCounters::k_countersCount; i++)
+		{
+			Utils::HardwareCounters::Counter counter = (Utils::HardwareCounters::Counter)i;
+			if (hardwareCounters.isAvailable() && hardwareCounters.isCounterAvailable(counter))
+			{
+				m_frameSeries.addField(sample.counters[counter]);
+			}
+			else
+			{
+				m_frameSeries.addEmptyField();
+			}
+		}
+		m_frameSeries.endRow();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	std::string StatsSystem::getOutputPath(const std::string& extension) const
+	{
+		return std::filesystem::path(m_outputPath).replace_extension(extension).string();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void StatsSystem::saveUsage(std::ostream& outFile, const std::string& name, const std::vector<float>& usage)
+	{
+		if (usage.empty())
+		{
+			return;
+		}
+
+		outFile << "Average " << name << ": " << std::accumulate(usage.begin(), usage.end(), 0.0) / usage.size() << std::endl;
+		outFile << "Max " << name << ": " << *std::max_element(usage.begin(), usage.end()) << std::endl;
+		outFile << "Min " << name << ": " << *std::min_element(usage.begin(), usage.end()) << std::endl;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void StatsSystem::saveProcessMetrics(std::ostream& outFile) const
+	{
+		if (!m_firstRecordedMetrics)
+		{
+			return;
+		}
+
+		// thread usage is in percent of one core, so the worker threads together can go above 100
+		saveUsage(outFile, "process CPU usage", m_processCpuUsage);
+		saveUsage(outFile, "main thread CPU usage", m_mainThreadCpuUsage);
+		saveUsage(outFile, "worker threads CPU usage", m_workerThreadsCpuUsage);
+		outFile << "Peak memory usage: " << m_lastRecordedMetrics.peakMemoryUsage << std::endl;
+
+		// the provider reports totals since the process started, only the recorded part is saved
+		const Utils::MetricsSample& first = *m_firstRecordedMetrics;
+		const Utils::MetricsSample& last = m_lastRecordedMetrics;
+		outFile << "Page faults: " << last.pageFaults - first.pageFaults << std::endl;
+		if (first.majorPageFaults && last.majorPageFaults)
+		{
+			outFile << "Major page faults: " << *last.majorPageFaults - *first.majorPageFaults << std::endl;
+		}
+		if (first.voluntaryContextSwitches && last.voluntaryContextSwitches)
+		{
+			outFile << "Voluntary context switches: " << *last.voluntaryContextSwitches - *first.voluntaryContextSwitches << std::endl;
+		}
+		if (first.involuntaryContextSwitches && last.involuntaryContextSwitches)
+		{
+			outFile << "Involuntary context switches: " << *last.involuntaryContextSwitches - *first.involuntaryContextSwitches << std::endl;
+		}
+
+		for (const auto& [id, usage] : m_threadUsage)
+		{
+			outFile << usage.name << " average CPU usage: " << usage.cpuUsageSum / usage.samplesCount << std::endl;
+			outFile << usage.name << " CPU time: " << usage.cpuTime << std::endl;
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	std::string StatsSystem::getThreadName(const Utils::ThreadCpuUsage& thread)
+	{
+		std::string name = thread.mainThread ? "Main thread" : "Thread " + std::to_string(thread.id);
+		if (!thread.name.empty())
+		{
+			name += " " + thread.name;
+		}
+		return name;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void StatsSystem::saveRendererStats(std::ostream& outFile, float averageFrameTime) const
+	{
+		double framesCount = (double)m_frameTimes.getCount();
+		outFile << "Average draw calls per frame: " << m_recordedRendererStats.drawCalls / framesCount << std::endl;
+		outFile << "Average triangles per frame: " << m_recordedRendererStats.triangles / framesCount << std::endl;
+		outFile << "Average vertices per frame: " << m_recordedRendererStats.vertices / framesCount << std::endl;
+		outFile << "Average indices per frame: " << m_recordedRendererStats.indices / framesCount << std::endl;
+		outFile << "Average pipeline binds per frame: " << m_recordedRendererStats.pipelineBinds / framesCount << std::endl;
+		outFile << "Average buffer binds per frame: " << m_recordedRendererStats.bufferBinds / framesCount << std::endl;
+		outFile << "Average resource binds per frame: " << m_recordedRendererStats.resourceBinds / framesCount << std::endl;
+		outFile << "Average uniform updates per frame: " << m_recordedRendererStats.uniformUpdates / framesCount << std::endl;
+		outFile << "Average uploaded bytes per frame: " << m_recordedRendererStats.uploadedBytes / framesCount << std::endl;
+
+		// lets backends be compared on the cost of the work they submit rather than on raw frame time
+		if (m_recordedRendererStats.drawCalls > 0)
+		{
+			outFile << "Frame time per draw call: " << averageFrameTime * framesCount / m_recordedRendererStats.drawCalls << std::endl;
+		}
+		if (m_recordedRendererStats.triangles > 0)
+		{
+			outFile << "Frame time per triangle: " << averageFrameTime * framesCount / m_recordedRendererStats.triangles << std::endl;
+		}
+
+		if (m_recordedRendererStats.gpuTimedFrames > 0)
+		{
+			Visual::RendererFrameStats averageStats = m_recordedRendererStats / m_frameTimes.getCount();
+			outFile << "GPU timed frames: " << m_recordedRendererStats.gpuTimedFrames << std::endl;
+			outFile << "Average GPU frame time: " << 1e-9 * averageStats.gpuFrameTime << std::endl;
+			outFile << "Average GPU scene pass time: " << 1e-9 * averageStats.gpuScenePassTime << std::endl;
+			outFile << "Average GPU UI pass time: " << 1e-9 * averageStats.gpuUIPassTime << std::endl;
+			outFile << "Average GPU upload time: " << 1e-9 * averageStats.gpuUploadTime << std::endl;
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void StatsSystem::saveHardwareCounters(std::ostream& outFile) const
+	{
+		using Counter = Utils::HardwareCounters::Counter;
+
+		const Utils::HardwareCounters& hardwareCounters = Utils::HardwareCounters::get();
+		if (!hardwareCounters.isAvailable())
+		{
+			return;
+		}
+
+		for (size_t i = 0; i < Utils::HardwareCounters::k_countersCount; i++)
+		{
+			Counter counter = (Counter)i;
+			if (hardwareCounters.isCounterAvailable(counter))
+			{
+				outFile << "Average " << Utils::HardwareCounters::getCounterName(counter) << " per frame: " << (double)m_recordedCounters[counter] / m_frameTimes.getCount() << std::endl;
+			}
+		}
+
+		if (hardwareCounters.isCounterAvailable(Counter::Cycles) && hardwareCounters.isCounterAvailable(Counter::Instructions) && m_recordedCounters[Counter::Cycles] > 0)
+		{
+			outFile << "Instructions per cycle: " << (double)m_recordedCounters[Counter::Instructions] / m_recordedCounters[Counter::Cycles] << std::endl;
+		}
+
+		for (const SystemTimingStats& timing : GameController::get().getSystemsManager().getRecordedTimings())
+		{
+			if (timing.updatesCount == 0)
+			{
+				continue;
+			}
+
+			for (size_t i = 0; i < Utils::HardwareCounters::k_countersCount; i++)
+			{
+				Counter counter = (Counter)i;
+				if (hardwareCounters.isCounterAvailable(counter))
+				{
+					outFile << "System " << timing.name << " " << Utils::HardwareCounters::getCounterName(counter) << " per update: " << (double)timing.counters[counter] / timing.updatesCount << std::endl;
+				}
+			}
+		}
 	}
 
 	//////////////////////////////////////////////////////////////////////////
@@ -272,6 +654,10 @@ namespace Engine::Systems
 
 		m_rendererName = rendererName;
 
+		// the recorded data is owned by the sampler thread while it is running
+		bool samplerRunning = m_samplerThread.joinable();
+		stopSampler();
+
 		if (m_recordData)
 		{
 			saveRecordedData();
@@ -284,6 +670,295 @@ namespace Engine::Systems
 		m_gpuUsage.clear();
 		m_memoryUsage.clear();
 		m_gpuMemoryUsage.clear();
+		m_processCpuUsage.clear();
+		m_mainThreadCpuUsage.clear();
+		m_workerThreadsCpuUsage.clear();
+		m_threadUsage.clear();
+		m_firstRecordedMetrics.reset();
+		m_pacingErrors.clear();
+		m_recordedAllocations = 0;
+		m_recordedAllocationFrames = 0;
+		m_maxFrameAllocations = 0;
+		m_recordingStartTagUsage = Utils::AllocationTracker::get().getTagUsage();
+		m_recordingStartThreadUsage = Utils::AllocationTracker::get().getThreadUsage();
+		m_recordedCounters = {};
+		m_recordedRendererStats = {};
+		m_droppedFrameSamples = 0;
+		GameController::get().getSystemsManager().resetRecordedTimings();
+
+		if (m_recordData)
+		{
+			openFrameSeries();
+		}
+
+		if (samplerRunning)
+		{
+			startSampler();
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void StatsSystem::startSampler()
+	{
+		if (m_samplerThread.joinable())
+		{
+			return;
+		}
+
+		m_stopSampler = false;
+		m_samplerThread = std::thread(&StatsSystem::runSampler, this);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void StatsSystem::stopSampler()
+	{
+		if (!m_samplerThread.joinable())
+		{
+			return;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(m_samplerMutex);
+			m_stopSampler = true;
+		}
+		m_samplerCondition.notify_one();
+		m_samplerThread.join();
+
+		// the sampler is stopped, so the remaining samples can be consumed from this thread
+		drainFrameSamples();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void StatsSystem::runSampler()
+	{
+		std::unique_lock<std::mutex> lock(m_samplerMutex);
+		while (!m_samplerCondition.wait_for(lock, k_samplerDrainInterval, [this]() { return m_stopSampler; }))
+		{
+			lock.unlock();
+			drainFrameSamples();
+			lock.lock();
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void StatsSystem::popSystemTimes(const FrameSample& sample)
+	{
+		// a frame queues its system times before itself, the times left by a dropped frame come first and are skipped
+		std::fill(m_frameSeriesSystemTimes.begin(), m_frameSeriesSystemTimes.end(), -1.0f);
+		SystemTimeSample systemTime;
+		for (uint32_t popped = 0; popped < sample.systemsCount && m_systemTimeSamples.pop(systemTime);)
+		{
+			if (systemTime.frameIndex != (uint32_t)sample.frameIndex)
+			{
+				continue;
+			}
+			if (systemTime.systemIndex < m_frameSeriesSystemTimes.size())
+			{
+				m_frameSeriesSystemTimes[systemTime.systemIndex] = systemTime.time;
+			}
+			popped++;
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void StatsSystem::drainFrameSamples()
+	{
+		FrameSample sample;
+		while (m_frameSamples.pop(sample))
+		{
+			popSystemTimes(sample);
+			if (m_recordData)
+			{
+				m_frameTimes.add(sample.frameTime);
+			}
+			m_frameTimeChunk.add(sample.frameTime);
+			m_allocationsChunk += sample.allocations;
+			m_rendererStatsChunk += sample.rendererStats;
+			if (m_recordData)
+			{
+				m_recordedAllocations += sample.allocations;
+				m_recordedAllocationFrames++;
+				m_maxFrameAllocations = std::max(m_maxFrameAllocations, sample.allocations);
+				m_recordedCounters += sample.counters;
+				m_recordedRendererStats += sample.rendererStats;
+				writeFrameSeries(sample);
+			}
+
+			if (sample.hasPacingError)
+			{
+				if (m_recordData)
+				{
+					m_pacingErrors.add(sample.pacingError);
+				}
+				m_pacingErrorChunk.add(sample.pacingError);
+			}
+
+			m_timePassed += sample.frameTime;
+			if (m_timePassed > k_timeBetweenSamples)
+			{
+				m_timePassed = 0.0f;
+				collectStats();
+			}
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void StatsSystem::collectStats()
+	{
+		Utils::MetricsSample metrics;
+		bool metricsSampled = m_metricsProvider && m_metricsProvider->sample(metrics);
+
+		float mainThreadCpuUsage = 0.0f;
+		float workerThreadsCpuUsage = 0.0f;
+		for (const Utils::ThreadCpuUsage& thread : metrics.threads)
+		{
+			(thread.mainThread ? mainThreadCpuUsage : workerThreadsCpuUsage) += thread.cpuUsage;
+		}
+
+		if (metricsSampled)
+		{
+			recordMetrics(metrics, mainThreadCpuUsage, workerThreadsCpuUsage);
+		}
+
+		StatsData statsData{};
+		statsData.cpuUsage = metrics.cpuUsage;
+		statsData.gpuUsage = metrics.gpuUsage.value_or(0.0f);
+		statsData.memoryUsage = metrics.memoryUsage;
+		statsData.gpuMemoryUsage = metrics.gpuMemoryUsage.value_or(0.0f);
+		statsData.processCpuUsage = metrics.processCpuUsage;
+		statsData.mainThreadCpuUsage = mainThreadCpuUsage;
+		statsData.workerThreadsCpuUsage = workerThreadsCpuUsage;
+		statsData.avgFrameTime = m_frameTimeChunk.getMean();
+		statsData.avgFPS = 1.0f / statsData.avgFrameTime;
+		statsData.allocationsPerFrame = (float)m_allocationsChunk / m_frameTimeChunk.getCount();
+		statsData.rendererStats = m_rendererStatsChunk / m_frameTimeChunk.getCount();
+		statsData.gpuFrameTime = 1e-9f * statsData.rendererStats.gpuFrameTime;
+		statsData.gpuScenePassTime = 1e-9f * statsData.rendererStats.gpuScenePassTime;
+		statsData.gpuUIPassTime = 1e-9f * statsData.rendererStats.gpuUIPassTime;
+		statsData.gpuUploadTime = 1e-9f * statsData.rendererStats.gpuUploadTime;
+
+		statsData.frameTimePercentile99 = m_frameTimeChunk.getPercentile(99.0f);
+		statsData.pacingErrorMedian = m_pacingErrorChunk.getPercentile(50.0f);
+		statsData.pacingErrorPercentile99 = m_pacingErrorChunk.getPercentile(99.0f);
+
+		m_frameTimeChunk.clear();
+		m_pacingErrorChunk.clear();
+		m_allocationsChunk = 0;
+		m_rendererStatsChunk = {};
+		publishTelemetry(statsData);
+		GameController::get().getEventsManager().post<Events::StatsUpdate>(Events::StatsUpdate{ statsData });
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void StatsSystem::recordMetrics(const Utils::MetricsSample& metrics, float mainThreadCpuUsage, float workerThreadsCpuUsage)
+	{
+		if (!m_recordData)
+		{
+			return;
+		}
+
+		m_cpuUsage.push_back(metrics.cpuUsage);
+		m_processCpuUsage.push_back(metrics.processCpuUsage);
+		m_memoryUsage.push_back(metrics.memoryUsage);
+		if (metrics.gpuUsage)
+		{
+			m_gpuUsage.push_back(*metrics.gpuUsage);
+		}
+		if (metrics.gpuMemoryUsage)
+		{
+			m_gpuMemoryUsage.push_back(*metrics.gpuMemoryUsage);
+		}
+
+		for (const Utils::ThreadCpuUsage& thread : metrics.threads)
+		{
+			ThreadUsage& usage = m_threadUsage[thread.id];
+			usage.name = getThreadName(thread);
+			usage.cpuUsageSum += thread.cpuUsage;
+			usage.samplesCount++;
+			usage.cpuTime = thread.cpuTime;
+		}
+		m_mainThreadCpuUsage.push_back(mainThreadCpuUsage);
+		m_workerThreadsCpuUsage.push_back(workerThreadsCpuUsage);
+
+		if (!m_firstRecordedMetrics)
+		{
+			m_firstRecordedMetrics = metrics;
+		}
+		m_lastRecordedMetrics = metrics;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void StatsSystem::publishSystemsTiming(float dt)
+	{
+		// the timings are owned by the systems manager, so unlike the other stats they are published from the main thread
+		m_systemsTimingTimePassed += dt;
+		if (m_systemsTimingTimePassed < k_timeBetweenSamples)
+		{
+			return;
+		}
+
+		m_systemsTimingTimePassed = 0.0f;
+		GameController& gameController = GameController::get();
+		Events::SystemsTimingUpdate update{ gameController.getSystemsManager().getRecentTimings() };
+
+		Utils::TelemetryRing& telemetryRing = Utils::TelemetryRing::get();
+		if (telemetryRing.isOpen())
+		{
+			for (const SystemTimingStats& timing : update.systems)
+			{
+				Utils::TelemetryRing::SystemPayload payload{};
+				timing.name.copy(payload.name, sizeof(payload.name) - 1);
+				payload.budget = timing.budget;
+				payload.meanTime = timing.meanTime;
+				payload.percentile99Time = timing.percentile99Time;
+				payload.maxTime = timing.maxTime;
+				payload.budgetOverruns = timing.budgetOverruns;
+				payload.updatesCount = timing.updatesCount;
+				telemetryRing.publishSystem(payload);
+			}
+		}
+
+		gameController.getEventsManager().enqueue<Events::SystemsTimingUpdate>(update);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void StatsSystem::publishTelemetry(const FrameSample& sample)
+	{
+		Utils::TelemetryRing::FramePayload payload{};
+		payload.frameIndex = sample.frameIndex;
+		payload.frameTime = sample.frameTime;
+		payload.pacingError = sample.pacingError;
+		payload.allocations = sample.allocations;
+		payload.drawCalls = sample.rendererStats.drawCalls;
+		payload.triangles = sample.rendererStats.triangles;
+		Utils::TelemetryRing::get().publishFrame(payload);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void StatsSystem::publishTelemetry(const StatsData& statsData)
+	{
+		Utils::TelemetryRing::StatsPayload payload{};
+		payload.avgFPS = statsData.avgFPS;
+		payload.avgFrameTime = statsData.avgFrameTime;
+		payload.memoryUsage = statsData.memoryUsage;
+		payload.gpuMemoryUsage = statsData.gpuMemoryUsage;
+		payload.cpuUsage = statsData.cpuUsage;
+		payload.gpuUsage = statsData.gpuUsage;
+		payload.frameTimePercentile99 = statsData.frameTimePercentile99;
+		payload.pacingErrorMedian = statsData.pacingErrorMedian;
+		payload.pacingErrorPercentile99 = statsData.pacingErrorPercentile99;
+		payload.allocationsPerFrame = statsData.allocationsPerFrame;
+		Utils::TelemetryRing::get().publishStats(payload);
 	}
 
 	//////////////////////////////////////////////////////////////////////////
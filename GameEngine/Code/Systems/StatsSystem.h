@@ -3,11 +3,24 @@
 #include "ISystem.h"
 
 #include <vector>
+#include <array>
 #include <string>
+#include <map>
+#include <memory>
+#include <optional>
 #include <algorithm>
-#include <pdh.h>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 #include "Managers/EventsManager.h"
+#include "Events/StatsEvents.h"
+#include "Utils/SPSCQueue.h"
+#include "Utils/HardwareCounters.h"
+#include "Utils/IMetricsProvider.h"
+#include "Utils/HdrHistogram.h"
+#include "Utils/CsvWriter.h"
+#include "Utils/AllocationTracker.h"
 
 namespace Engine::Systems
 {
@@ -19,37 +32,124 @@ namespace Engine::Systems
 		void onStop() override;
 		int getPriority() const override;
 
+	private:
+		struct FrameSample
+		{
+			float frameTime;
+			float pacingError;
+			bool hasPacingError;
+			uint64_t allocations;
+			Utils::HardwareCounters::Values counters;
+			Visual::RendererFrameStats rendererStats;
+			uint64_t frameIndex;
+			// entries queued in m_systemTimeSamples for this frame
+			uint32_t systemsCount;
+		};
+
+		// the system names are taken once when the recording starts, frames only queue their times
+		struct SystemTimeSample
+		{
+			uint32_t frameIndex;
+			uint32_t systemIndex;
+			float time;
+		};
+
+		struct ThreadUsage
+		{
+			std::string name;
+			double cpuUsageSum = 0.0;
+			size_t samplesCount = 0;
+			float cpuTime = 0.0f;
+		};
+
 	private:
 		void saveRecordedData();
 		void onRecordingStateChanged(const std::string& rendererName, bool recordData);
+		void startSampler();
+		void stopSampler();
+		void runSampler();
+		void popSystemTimes(const FrameSample& sample);
+		void drainFrameSamples();
+		void collectStats();
+		void recordMetrics(const Utils::MetricsSample& metrics, float mainThreadCpuUsage, float workerThreadsCpuUsage);
+		void publishSystemsTiming(float dt);
+		void saveHardwareCounters(std::ostream& outFile) const;
+		void saveRendererStats(std::ostream& outFile, float averageFrameTime) const;
+		void saveProcessMetrics(std::ostream& outFile) const;
+		void saveJsonSummary(size_t objectsCount, double verticesPerFrame) const;
+		void openFrameSeries();
+		void writeFrameSeries(const FrameSample& sample);
+		std::string getOutputPath(const std::string& extension) const;
+		static nlohmann::json getBuildInfo();
+		static nlohmann::json getUsageJson(const std::vector<float>& usage);
+		static void saveUsage(std::ostream& outFile, const std::string& name, const std::vector<float>& usage);
+		static std::string getThreadName(const Utils::ThreadCpuUsage& thread);
+		void publishTelemetry(const FrameSample& sample);
+		static void publishTelemetry(const StatsData& statsData);
 	private:
 
-		constexpr static const float k_initialSleepTime = 1.0f;
 		constexpr static const float k_timeBetweenSamples = 1.0f;
+		constexpr static const std::chrono::milliseconds k_samplerDrainInterval = std::chrono::milliseconds(10);
+		constexpr static const size_t k_frameSamplesCapacity = 1 << 14;
+		constexpr static const size_t k_systemTimeSamplesCapacity = 1 << 15;
+		constexpr static const int k_summarySchemaVersion = 1;
+		constexpr static const char* k_summaryExtension = ".summary.json";
+		constexpr static const char* k_frameSeriesExtension = ".frames.csv";
 
-		PDH_HQUERY m_gpuUsageQuery;
-		PDH_HCOUNTER m_gpuUsageCounter;
-		PDH_HQUERY m_gpuMemoryUsageQuery;
-		PDH_HCOUNTER m_gpuMemoryUsageCounter;
-		PDH_HQUERY m_cpuQuery;
-		PDH_HCOUNTER m_cpuUsageCounter;
+		std::unique_ptr<Utils::IMetricsProvider> m_metricsProvider;
 
 		float m_creationTime;
-		std::vector<float> m_frameTimes;
+		Utils::HdrHistogram m_frameTimes;
 		std::vector<float> m_memoryUsage;
 		std::vector<float> m_cpuUsage;
 		std::vector<float> m_gpuUsage;
 		std::vector<float> m_gpuMemoryUsage;
+		std::vector<float> m_processCpuUsage;
+		std::vector<float> m_mainThreadCpuUsage;
+		std::vector<float> m_workerThreadsCpuUsage;
+		std::map<uint64_t, ThreadUsage> m_threadUsage;
+		std::optional<Utils::MetricsSample> m_firstRecordedMetrics;
+		Utils::MetricsSample m_lastRecordedMetrics;
 
 		bool m_firstUpdate;
 		bool m_recordData = false;
 		float m_timePassed;
-		std::vector<float> m_frameTimeChunk;
+		float m_systemsTimingTimePassed = 0.0f;
+		Utils::HdrHistogram m_frameTimeChunk;
+		Utils::HdrHistogram m_pacingErrors;
+		Utils::HdrHistogram m_pacingErrorChunk;
+		uint64_t m_recordedAllocations = 0;
+		uint64_t m_recordedAllocationFrames = 0;
+		uint64_t m_maxFrameAllocations = 0;
+		std::vector<Utils::AllocationTracker::Usage> m_recordingStartTagUsage;
+		std::vector<Utils::AllocationTracker::Usage> m_recordingStartThreadUsage;
+		uint64_t m_allocationsChunk = 0;
+		Utils::HardwareCounters::Reading m_lastCounters;
+		Utils::HardwareCounters::Values m_recordedCounters;
+		Visual::RendererFrameStats m_lastRendererStats;
+		Visual::RendererFrameStats m_rendererStatsChunk;
+		Visual::RendererFrameStats m_recordedRendererStats;
 		std::string m_outputPath;
 		std::string m_rendererName;
 
+		std::vector<float> m_systemTimes;
+		std::vector<std::string> m_frameSeriesSystems;
+		std::vector<float> m_frameSeriesSystemTimes;
+		Utils::CsvWriter m_frameSeries;
+
+		Utils::SPSCQueue<FrameSample, k_frameSamplesCapacity> m_frameSamples;
+		Utils::SPSCQueue<SystemTimeSample, k_systemTimeSamplesCapacity> m_systemTimeSamples;
+		size_t m_droppedFrameSamples = 0;
+		uint64_t m_framesCount = 0;
+
+		std::thread m_samplerThread;
+		std::mutex m_samplerMutex;
+		std::condition_variable m_samplerCondition;
+		bool m_stopSampler = false;
+
 		EventListenerID m_recordingUpdateListenerId = -1;
 		EventListenerID m_outputFileUpdateListenerId = -1;
+		EventListenerID m_rendererStatsListenerId = -1;
 
 	};
 }
\ No newline at end of file
@@ -0,0 +1,332 @@
+#include "AllocationTracker.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <new>
+#include <malloc.h>
+
+namespace Engine::Utils
+{
+	namespace
+	{
+		// plain thread locals are used because the hooks must not allocate while they are initialized
+		thread_local size_t t_currentTag = 0;
+		thread_local void* t_threadCounters = nullptr;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	AllocationTracker& AllocationTracker::get()
+	{
+		// constant initialized, so allocations made before main are counted as well
+		static constinit AllocationTracker tracker;
+		return tracker;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	bool AllocationTracker::isEnabled()
+	{
+#ifdef _TRACK_ALLOCATIONS
+		return true;
+#else
+		return false;
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void AllocationTracker::onAllocation(size_t size)
+	{
+		m_totals.allocations.fetch_add(1, std::memory_order_relaxed);
+		m_totals.bytes.fetch_add(size, std::memory_order_relaxed);
+
+		Counters& tagCounters = m_tags[t_currentTag].counters;
+		tagCounters.allocations.fetch_add(1, std::memory_order_relaxed);
+		tagCounters.bytes.fetch_add(size, std::memory_order_relaxed);
+
+		Counters& threadCounters = getThreadCounters();
+		threadCounters.allocations.fetch_add(1, std::memory_order_relaxed);
+		threadCounters.bytes.fetch_add(size, std::memory_order_relaxed);
+
+		int64_t liveBytes = m_liveBytes.fetch_add(size, std::memory_order_relaxed) + size;
+		int64_t peakLiveBytes = m_peakLiveBytes.load(std::memory_order_relaxed);
+		while (liveBytes > peakLiveBytes && !m_peakLiveBytes.compare_exchange_weak(peakLiveBytes, liveBytes, std::memory_order_relaxed))
+		{
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void AllocationTracker::onDeallocation(size_t size)
+	{
+		m_liveBytes.fetch_sub(size, std::memory_order_relaxed);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	size_t AllocationTracker::registerTag(const char* name)
+	{
+		// tags are only appended, so the published ones can be searched without the lock
+		size_t tagsCount = m_tagsCount.load(std::memory_order_acquire);
+		for (size_t i = 0; i < tagsCount; i++)
+		{
+			if (std::strncmp(m_tags[i].name, name, sizeof(m_tags[i].name) - 1) == 0)
+			{
+				return i;
+			}
+		}
+
+		std::lock_guard<std::mutex> lock(m_tagsMutex);
+		for (size_t i = tagsCount; i < m_tagsCount.load(std::memory_order_relaxed); i++)
+		{
+			if (std::strncmp(m_tags[i].name, name, sizeof(m_tags[i].name) - 1) == 0)
+			{
+				return i;
+			}
+		}
+
+		tagsCount = m_tagsCount.load(std::memory_order_relaxed);
+		if (tagsCount == k_maxTags)
+		{
+			return k_untaggedTag;
+		}
+
+		std::strncpy(m_tags[tagsCount].name, name, sizeof(m_tags[tagsCount].name) - 1);
+		m_tagsCount.store(tagsCount + 1, std::memory_order_release);
+		return tagsCount;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	size_t AllocationTracker::setCurrentTag(size_t tag)
+	{
+		size_t previousTag = t_currentTag;
+		t_currentTag = tag;
+		return previousTag;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void AllocationTracker::markFrame()
+	{
+		uint64_t allocations = m_totals.allocations.load(std::memory_order_relaxed);
+		uint64_t bytes = m_totals.bytes.load(std::memory_order_relaxed);
+		bool firstFrame = !m_frameStarted;
+
+		m_lastFrameAllocations = allocations - m_frameStartAllocations;
+		m_lastFrameBytes = bytes - m_frameStartBytes;
+		m_frameStartAllocations = allocations;
+		m_frameStartBytes = bytes;
+		m_frameStarted = true;
+
+		// everything allocated before the first frame would otherwise count as a single frame
+		if (firstFrame)
+		{
+			m_lastFrameAllocations = 0;
+			m_lastFrameBytes = 0;
+			return;
+		}
+
+		m_peakFrameAllocations = std::max(m_peakFrameAllocations, m_lastFrameAllocations);
+		m_peakFrameBytes = std::max(m_peakFrameBytes, m_lastFrameBytes);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	uint64_t AllocationTracker::getLastFrameAllocations() const
+	{
+		return m_lastFrameAllocations;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	uint64_t AllocationTracker::getLastFrameBytes() const
+	{
+		return m_lastFrameBytes;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	uint64_t AllocationTracker::getPeakFrameAllocations() const
+	{
+		return m_peakFrameAllocations;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	uint64_t AllocationTracker::getPeakFrameBytes() const
+	{
+		return m_peakFrameBytes;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	int64_t AllocationTracker::getLiveBytes() const
+	{
+		return m_liveBytes.load(std::memory_order_relaxed);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	int64_t AllocationTracker::getPeakLiveBytes() const
+	{
+		return m_peakLiveBytes.load(std::memory_order_relaxed);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	std::vector<AllocationTracker::Usage> AllocationTracker::getTagUsage() const
+	{
+		std::vector<Usage> usage;
+		size_t tagsCount = m_tagsCount.load(std::memory_order_acquire);
+		for (size_t i = 0; i < tagsCount; i++)
+		{
+			const Counters& counters = m_tags[i].counters;
+			usage.push_back({
+				m_tags[i].name,
+				counters.allocations.load(std::memory_order_relaxed),
+				counters.bytes.load(std::memory_order_relaxed) });
+		}
+		return usage;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	std::vector<AllocationTracker::Usage> AllocationTracker::getThreadUsage() const
+	{
+		std::vector<Usage> usage;
+		size_t threadsCount = std::min(m_threadsCount.load(std::memory_order_relaxed), k_maxThreads);
+		for (size_t i = 0; i < threadsCount; i++)
+		{
+			const Counters& counters = m_threads[i];
+			usage.push_back({
+				"Thread " + std::to_string(i),
+				counters.allocations.load(std::memory_order_relaxed),
+				counters.bytes.load(std::memory_order_relaxed) });
+		}
+		return usage;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	std::vector<AllocationTracker::Usage> AllocationTracker::getUsageSince(const std::vector<Usage>& usage, const std::vector<Usage>& baseline)
+	{
+		std::vector<Usage> difference = usage;
+		for (size_t i = 0; i < difference.size() && i < baseline.size(); i++)
+		{
+			difference[i].allocations -= baseline[i].allocations;
+			difference[i].bytes -= baseline[i].bytes;
+		}
+		return difference;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	AllocationTracker::Counters& AllocationTracker::getThreadCounters()
+	{
+		// threads past the limit share the last slot
+		if (t_threadCounters == nullptr)
+		{
+			size_t index = std::min(m_threadsCount.fetch_add(1, std::memory_order_relaxed), k_maxThreads - 1);
+			t_threadCounters = &m_threads[index];
+		}
+		return *static_cast<Counters*>(t_threadCounters);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+}
+
+#ifdef _TRACK_ALLOCATIONS
+
+namespace
+{
+	size_t getAllocationSize(void* ptr)
+	{
+#ifdef _MSC_VER
+		return _msize(ptr);
+#else
+		return malloc_usable_size(ptr);
+#endif
+	}
+
+	void* trackedAllocate(size_t size)
+	{
+		void* ptr = std::malloc(size > 0 ? size : 1);
+		if (ptr != nullptr)
+		{
+			Engine::Utils::AllocationTracker::get().onAllocation(getAllocationSize(ptr));
+		}
+		return ptr;
+	}
+
+	void trackedFree(void* ptr)
+	{
+		if (ptr == nullptr)
+		{
+			return;
+		}
+		Engine::Utils::AllocationTracker::get().onDeallocation(getAllocationSize(ptr));
+		std::free(ptr);
+	}
+}
+
+// the over-aligned overloads keep their default implementations and are not tracked
+
+void* operator new(size_t size)
+{
+	void* ptr = trackedAllocate(size);
+	if (ptr == nullptr)
+	{
+		throw std::bad_alloc();
+	}
+	return ptr;
+}
+
+void* operator new[](size_t size)
+{
+	return operator new(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+	return trackedAllocate(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept
+{
+	return trackedAllocate(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+	trackedFree(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+	trackedFree(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+	trackedFree(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept
+{
+	trackedFree(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+	trackedFree(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+	trackedFree(ptr);
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Engine::Utils
+{
+	// Counts heap allocations per frame, per thread and per tag. The global operator new/delete
+	// are only replaced when _TRACK_ALLOCATIONS is defined, otherwise all counters stay at zero.
+	class AllocationTracker
+	{
+	public:
+		struct Usage
+		{
+			std::string name;
+			uint64_t allocations;
+			uint64_t bytes;
+		};
+
+		static AllocationTracker& get();
+		static bool isEnabled();
+
+		void onAllocation(size_t size);
+		void onDeallocation(size_t size);
+
+		size_t registerTag(const char* name);
+		size_t setCurrentTag(size_t tag);
+
+		void markFrame();
+
+		uint64_t getLastFrameAllocations() const;
+		uint64_t getLastFrameBytes() const;
+		uint64_t getPeakFrameAllocations() const;
+		uint64_t getPeakFrameBytes() const;
+		int64_t getLiveBytes() const;
+		int64_t getPeakLiveBytes() const;
+
+		std::vector<Usage> getTagUsage() const;
+		std::vector<Usage> getThreadUsage() const;
+		// tags and threads are only appended, so entries of both lists match by index
+		static std::vector<Usage> getUsageSince(const std::vector<Usage>& usage, const std::vector<Usage>& baseline);
+
+		constexpr AllocationTracker() = default;
+
+	private:
+		struct Counters
+		{
+			std::atomic<uint64_t> allocations = 0;
+			std::atomic<uint64_t> bytes = 0;
+		};
+
+		struct TagCounters
+		{
+			char name[32]{};
+			Counters counters;
+		};
+
+	private:
+		Counters& getThreadCounters();
+
+	private:
+		static constexpr size_t k_maxTags = 64;
+		static constexpr size_t k_maxThreads = 64;
+		static constexpr size_t k_untaggedTag = 0;
+
+		Counters m_totals;
+		std::atomic<int64_t> m_liveBytes = 0;
+		std::atomic<int64_t> m_peakLiveBytes = 0;
+
+		std::array<TagCounters, k_maxTags> m_tags{ { { "Untagged" } } };
+		std::atomic<size_t> m_tagsCount = 1;
+		std::mutex m_tagsMutex;
+
+		std::array<Counters, k_maxThreads> m_threads{};
+		std::atomic<size_t> m_threadsCount = 0;
+
+		bool m_frameStarted = false;
+		uint64_t m_frameStartAllocations = 0;
+		uint64_t m_frameStartBytes = 0;
+		uint64_t m_lastFrameAllocations = 0;
+		uint64_t m_lastFrameBytes = 0;
+		uint64_t m_peakFrameAllocations = 0;
+		uint64_t m_peakFrameBytes = 0;
+	};
+
+	class AllocationScope
+	{
+	public:
+		explicit AllocationScope(const char* tag);
+		// takes a tag from registerTag, for scopes entered too often to look the name up each time
+		explicit AllocationScope(size_t tag);
+		~AllocationScope();
+
+		AllocationScope(const AllocationScope&) = delete;
+		AllocationScope& operator=(const AllocationScope&) = delete;
+
+	private:
+		size_t m_previousTag;
+	};
+}
+
+#ifdef _TRACK_ALLOCATIONS
+
+#define ALLOCATION_CONCAT_IMPL(a, b) a##b
+#define ALLOCATION_CONCAT(a, b) ALLOCATION_CONCAT_IMPL(a, b)
+#define ALLOCATION_SCOPE(tag) const Engine::Utils::AllocationScope ALLOCATION_CONCAT(allocationScope, __LINE__)(tag)
+#define ALLOCATION_TAG_SCOPE(tagId) const Engine::Utils::AllocationScope ALLOCATION_CONCAT(allocationScope, __LINE__)(static_cast<size_t>(tagId))
+
+#else
+
+#define ALLOCATION_SCOPE(tag) do { } while (false)
+#define ALLOCATION_TAG_SCOPE(tagId) do { } while (false)
+
+#endif
+
+#include "AllocationTracker.inl"
\ No newline at end of file
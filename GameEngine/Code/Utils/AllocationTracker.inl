@@ -0,0 +1,29 @@
+#pragma once
+
+#include "AllocationTracker.h"
+
+namespace Engine::Utils
+{
+	//////////////////////////////////////////////////////////////////////////
+
+	inline AllocationScope::AllocationScope(const char* tag)
+		: m_previousTag(AllocationTracker::get().setCurrentTag(AllocationTracker::get().registerTag(tag)))
+	{
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	inline AllocationScope::AllocationScope(size_t tag)
+		: m_previousTag(AllocationTracker::get().setCurrentTag(tag))
+	{
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	inline AllocationScope::~AllocationScope()
+	{
+		AllocationTracker::get().setCurrentTag(m_previousTag);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+}
\ No newline at end of file
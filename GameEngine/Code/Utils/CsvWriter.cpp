@@ -0,0 +1,111 @@
+#include "CsvWriter.h"
+
+namespace Engine::Utils
+{
+	//////////////////////////////////////////////////////////////////////////
+
+	bool CsvWriter::open(const std::string& path)
+	{
+		close();
+		m_file.open(path, std::ios::binary);
+		m_buffer.reserve(2 * k_flushSize);
+		return m_file.is_open();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void CsvWriter::close()
+	{
+		if (!m_file.is_open())
+		{
+			return;
+		}
+
+		if (m_rowStarted)
+		{
+			endRow();
+		}
+		flush();
+		m_file.close();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	bool CsvWriter::isOpen() const
+	{
+		return m_file.is_open();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void CsvWriter::addField(std::string_view value)
+	{
+		beginField();
+		if (value.find_first_of(",\"\r\n") == std::string_view::npos)
+		{
+			m_buffer += value;
+			return;
+		}
+
+		m_buffer += '"';
+		for (char c : value)
+		{
+			if (c == '"')
+			{
+				m_buffer += '"';
+			}
+			m_buffer += c;
+		}
+		m_buffer += '"';
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void CsvWriter::addEmptyField()
+	{
+		beginField();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void CsvWriter::endRow()
+	{
+		m_buffer += '\n';
+		m_rowStarted = false;
+		if (m_buffer.size() >= k_flushSize)
+		{
+			flush();
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	CsvWriter::~CsvWriter()
+	{
+		close();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void CsvWriter::beginField()
+	{
+		if (m_rowStarted)
+		{
+			m_buffer += ',';
+		}
+		m_rowStarted = true;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void CsvWriter::flush()
+	{
+		if (m_file.is_open() && !m_buffer.empty())
+		{
+			m_file.write(m_buffer.data(), m_buffer.size());
+		}
+		m_buffer.clear();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+}
\ No newline at end of file
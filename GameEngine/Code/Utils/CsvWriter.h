@@ -0,0 +1,40 @@
+#pragma once
+
+#include <fstream>
+#include <string>
+#include <type_traits>
+#include <string_view>
+
+namespace Engine::Utils
+{
+	// Appends rows to a CSV file through an in-memory buffer that is written out once it grows past k_flushSize,
+	// so a long series is streamed to disk without keeping it around and without a write per field.
+	class CsvWriter
+	{
+	public:
+		bool open(const std::string& path);
+		void close();
+		bool isOpen() const;
+
+		template <typename T> requires std::is_arithmetic_v<T>
+		void addField(T value);
+		void addField(std::string_view value);
+		void addEmptyField();
+		void endRow();
+
+		~CsvWriter();
+
+	private:
+		void beginField();
+		void flush();
+
+	private:
+		static constexpr size_t k_flushSize = 1 << 16;
+
+		std::ofstream m_file;
+		std::string m_buffer;
+		bool m_rowStarted = false;
+	};
+}
+
+#include "CsvWriter.inl"
\ No newline at end of file
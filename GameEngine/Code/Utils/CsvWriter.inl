@@ -0,0 +1,28 @@
+#pragma once
+
+#include "CsvWriter.h"
+
+#include <charconv>
+
+namespace Engine::Utils
+{
+	//////////////////////////////////////////////////////////////////////////
+
+	template <typename T> requires std::is_arithmetic_v<T>
+	void CsvWriter::addField(T value)
+	{
+		beginField();
+		if constexpr (std::is_same_v<T, bool>)
+		{
+			m_buffer += value ? '1' : '0';
+		}
+		else
+		{
+			char field[32];
+			std::to_chars_result result = std::to_chars(field, field + sizeof(field), value);
+			m_buffer.append(field, result.ptr);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+}
\ No newline at end of file
@@ -1,32 +1,68 @@
 #pragma once
 
+#include "Logger.h"
+
 #ifdef _DEBUG
 
-#include <iostream>
-#include <format>
 #include <GL/glew.h>
 
+// Failed checks bypass the logger's rings and are written before breaking,
+// so the message is on screen when the debugger stops.
 #define ASSERT(condition, message, ...) \
     do { \
         if (!(condition)) { \
-            std::cout << "Assertion failed: (" << #condition << "), " \
-                      << "file " << __FILE__ << ", line " << __LINE__ << "." << std::endl \
-                      << "Message: " << std::format(message, __VA_ARGS__) << std::endl; \
+            static constexpr Engine::Utils::LogSite logSite{ Engine::Utils::LogLevel::AssertFailed, message, #condition, __FILE__, __LINE__ }; \
+            Engine::Utils::Logger::get().logSync(logSite, ##__VA_ARGS__); \
             __debugbreak(); \
         } \
     } while (false)
 
-#define ASSERT_OPENGL(message, ...) \
+#define ASSERT_OPENGL_CALL(message, ...) \
     do { \
         GLenum error = glGetError(); \
         if (error != GL_NO_ERROR) { \
-            std::cout << "OpenGL error check failed: error code=(" << error  << "), " \
-                      << "file " << __FILE__ << ", line " << __LINE__ << "." << std::endl \
-                      << "Message: " << std::format(message, __VA_ARGS__) << std::endl; \
+            static constexpr Engine::Utils::LogSite logSite{ Engine::Utils::LogLevel::OpenGLError, message, nullptr, __FILE__, __LINE__ }; \
+            Engine::Utils::Logger::get().logSync(logSite, error, ##__VA_ARGS__); \
             __debugbreak(); \
         } \
     } while (false)
 
+#ifdef _BATCH_OPENGL_ERRORS
+
+// glGetError synchronizes with the driver, with _BATCH_OPENGL_ERRORS the calls only remember
+// where they are and ASSERT_OPENGL_FRAME checks the error flag once per frame. A frame with an error
+// makes the next frame check every call, which stops at the first failing one with its arguments.
+#define ASSERT_OPENGL(message, ...) \
+    do { \
+        if (Engine::Utils::Logger::shouldCheckOpenGLCalls()) { \
+            ASSERT_OPENGL_CALL(message, ##__VA_ARGS__); \
+        } \
+        else { \
+            static constexpr Engine::Utils::LogSite logSite{ Engine::Utils::LogLevel::OpenGLFrameError, message, nullptr, __FILE__, __LINE__ }; \
+            Engine::Utils::Logger::setLastOpenGLSite(logSite); \
+        } \
+    } while (false)
+
+#define ASSERT_OPENGL_FRAME() \
+    do { \
+        const Engine::Utils::LogSite* logSite = Engine::Utils::Logger::getLastOpenGLSite(); \
+        GLenum error = glGetError(); \
+        Engine::Utils::Logger::setCheckOpenGLCalls(false); \
+        if (error != GL_NO_ERROR && logSite != nullptr) { \
+            Engine::Utils::Logger::get().logSync(*logSite, error); \
+            Engine::Utils::Logger::setCheckOpenGLCalls(true); \
+        } \
+    } while (false)
+
+#else
+
+#define ASSERT_OPENGL(message, ...) ASSERT_OPENGL_CALL(message, ##__VA_ARGS__)
+
+#define ASSERT_OPENGL_FRAME() \
+    do {} while (false)
+
+#endif
+
 #else
 
 #define ASSERT(condition, message, ...) \
@@ -35,4 +71,7 @@
 #define ASSERT_OPENGL(message, ...) \
     do {} while (false)
 
-#endif
+#define ASSERT_OPENGL_FRAME() \
+    do {} while (false)
+
+#endif
\ No newline at end of file
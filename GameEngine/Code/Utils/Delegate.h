@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <utility>
+#include <type_traits>
+
+namespace Engine::Utils
+{
+	template <typename Signature, size_t BufferSize = 4 * sizeof(void*)>
+	class Delegate;
+
+	// Move-only callable wrapper that stores the target inline and never allocates.
+	// Callables that don't fit into BufferSize are rejected at compile time.
+	template <typename Result, typename... Args, size_t BufferSize>
+	class Delegate<Result(Args...), BufferSize>
+	{
+	public:
+		Delegate() = default;
+		Delegate(std::nullptr_t);
+
+		template <typename Callable, typename = std::enable_if_t<!std::is_same_v<std::decay_t<Callable>, Delegate>>>
+		Delegate(Callable&& callable);
+
+		Delegate(Delegate&& other) noexcept;
+		Delegate& operator=(Delegate&& other) noexcept;
+		Delegate(const Delegate&) = delete;
+		Delegate& operator=(const Delegate&) = delete;
+		~Delegate();
+
+		Result operator()(Args... args) const;
+		explicit operator bool() const;
+
+	private:
+		enum class Operation
+		{
+			Move,
+			Destroy
+		};
+
+		using Invoker = Result(*)(void* storage, Args&&... args);
+		using Manager = void(*)(Operation operation, void* storage, void* other);
+
+		template <typename Callable>
+		static Result invoke(void* storage, Args&&... args);
+
+		template <typename Callable>
+		static void manage(Operation operation, void* storage, void* other);
+
+		void reset();
+
+	private:
+		alignas(std::max_align_t) mutable unsigned char m_storage[BufferSize];
+		Invoker m_invoker = nullptr;
+		Manager m_manager = nullptr;
+	};
+}
+
+#include "Delegate.inl"
\ No newline at end of file
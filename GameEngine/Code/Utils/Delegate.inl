@@ -0,0 +1,129 @@
+#pragma once
+
+#include "Delegate.h"
+
+namespace Engine::Utils
+{
+	//////////////////////////////////////////////////////////////////////////
+
+	template <typename Result, typename... Args, size_t BufferSize>
+	Delegate<Result(Args...), BufferSize>::Delegate(std::nullptr_t)
+	{
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	template <typename Result, typename... Args, size_t BufferSize>
+	template <typename Callable, typename>
+	Delegate<Result(Args...), BufferSize>::Delegate(Callable&& callable)
+	{
+		using Target = std::decay_t<Callable>;
+		static_assert(sizeof(Target) <= BufferSize, "Callable is too big for the delegate buffer, capture less or increase BufferSize");
+		static_assert(alignof(Target) <= alignof(std::max_align_t), "Callable is over-aligned for the delegate buffer");
+		static_assert(std::is_nothrow_move_constructible_v<Target>, "Callable must be nothrow move constructible");
+
+		new (m_storage) Target(std::forward<Callable>(callable));
+		m_invoker = &invoke<Target>;
+		m_manager = &manage<Target>;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	template <typename Result, typename... Args, size_t BufferSize>
+	Delegate<Result(Args...), BufferSize>::Delegate(Delegate&& other) noexcept
+	{
+		if (other.m_manager)
+		{
+			other.m_manager(Operation::Move, m_storage, other.m_storage);
+			m_invoker = other.m_invoker;
+			m_manager = other.m_manager;
+			other.reset();
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	template <typename Result, typename... Args, size_t BufferSize>
+	Delegate<Result(Args...), BufferSize>& Delegate<Result(Args...), BufferSize>::operator=(Delegate&& other) noexcept
+	{
+		if (this == &other)
+		{
+			return *this;
+		}
+
+		reset();
+		if (other.m_manager)
+		{
+			other.m_manager(Operation::Move, m_storage, other.m_storage);
+			m_invoker = other.m_invoker;
+			m_manager = other.m_manager;
+			other.reset();
+		}
+		return *this;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	template <typename Result, typename... Args, size_t BufferSize>
+	Delegate<Result(Args...), BufferSize>::~Delegate()
+	{
+		reset();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	template <typename Result, typename... Args, size_t BufferSize>
+	Result Delegate<Result(Args...), BufferSize>::operator()(Args... args) const
+	{
+		return m_invoker(m_storage, std::forward<Args>(args)...);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	template <typename Result, typename... Args, size_t BufferSize>
+	Delegate<Result(Args...), BufferSize>::operator bool() const
+	{
+		return m_invoker != nullptr;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	template <typename Result, typename... Args, size_t BufferSize>
+	template <typename Callable>
+	Result Delegate<Result(Args...), BufferSize>::invoke(void* storage, Args&&... args)
+	{
+		return (*static_cast<Callable*>(storage))(std::forward<Args>(args)...);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	template <typename Result, typename... Args, size_t BufferSize>
+	template <typename Callable>
+	void Delegate<Result(Args...), BufferSize>::manage(Operation operation, void* storage, void* other)
+	{
+		switch (operation)
+		{
+		case Operation::Move:
+			new (storage) Callable(std::move(*static_cast<Callable*>(other)));
+			break;
+		case Operation::Destroy:
+			static_cast<Callable*>(storage)->~Callable();
+			break;
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	template <typename Result, typename... Args, size_t BufferSize>
+	void Delegate<Result(Args...), BufferSize>::reset()
+	{
+		if (m_manager)
+		{
+			m_manager(Operation::Destroy, m_storage, nullptr);
+		}
+		m_invoker = nullptr;
+		m_manager = nullptr;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+}
\ No newline at end of file
@@ -0,0 +1,128 @@
+#include "FrameLimiter.h"
+
+#include <Windows.h>
+#include <immintrin.h>
+
+namespace Engine::Utils
+{
+	//////////////////////////////////////////////////////////////////////////
+
+	FrameLimiter::FrameLimiter()
+	{
+		m_timer = CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+		if (m_timer == nullptr)
+		{
+			// high resolution timers are only available since Windows 10 1803
+			m_timer = CreateWaitableTimerExW(nullptr, nullptr, 0, TIMER_ALL_ACCESS);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	FrameLimiter::~FrameLimiter()
+	{
+		if (m_timer != nullptr)
+		{
+			CloseHandle(m_timer);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void FrameLimiter::setTargetFPS(float targetFPS)
+	{
+		m_targetFPS = targetFPS > 0.0f ? targetFPS : 0.0f;
+		if (m_targetFPS > 0.0f)
+		{
+			m_frameDuration = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / m_targetFPS));
+		}
+		else
+		{
+			m_frameDuration = Clock::duration::zero();
+		}
+		reset();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	float FrameLimiter::getTargetFPS() const
+	{
+		return m_targetFPS;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void FrameLimiter::reset()
+	{
+		m_hasDeadline = false;
+		m_lastPacingError.reset();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void FrameLimiter::wait()
+	{
+		if (m_targetFPS <= 0.0f)
+		{
+			return;
+		}
+
+		Clock::time_point now = Clock::now();
+		if (!m_hasDeadline)
+		{
+			m_deadline = now + m_frameDuration;
+			m_hasDeadline = true;
+			return;
+		}
+
+		Clock::duration remaining = m_deadline - now;
+		if (remaining > k_spinThreshold)
+		{
+			sleepFor(remaining - k_spinThreshold);
+		}
+
+		while (Clock::now() < m_deadline)
+		{
+			_mm_pause();
+		}
+
+		now = Clock::now();
+		std::chrono::duration<float> pacingError = now - m_deadline;
+		m_lastPacingError = pacingError.count();
+
+		m_deadline += m_frameDuration;
+		// a frame that took longer than the budget resynchronizes instead of bursting to catch up
+		if (m_deadline < now)
+		{
+			m_deadline = now + m_frameDuration;
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	std::optional<float> FrameLimiter::getLastPacingError() const
+	{
+		return m_lastPacingError;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void FrameLimiter::sleepFor(Clock::duration duration) const
+	{
+		if (m_timer == nullptr)
+		{
+			Sleep((DWORD)std::chrono::duration_cast<std::chrono::milliseconds>(duration).count());
+			return;
+		}
+
+		// relative due time in 100 ns intervals
+		LARGE_INTEGER dueTime;
+		dueTime.QuadPart = -(LONGLONG)(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count() / 100);
+		if (SetWaitableTimer(m_timer, &dueTime, 0, nullptr, nullptr, FALSE))
+		{
+			WaitForSingleObject(m_timer, INFINITE);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+}
\ No newline at end of file
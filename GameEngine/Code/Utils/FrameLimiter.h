@@ -0,0 +1,38 @@
+#pragma once
+
+#include <chrono>
+#include <optional>
+
+namespace Engine::Utils
+{
+	class FrameLimiter
+	{
+	public:
+		FrameLimiter();
+		~FrameLimiter();
+
+		FrameLimiter(const FrameLimiter&) = delete;
+		FrameLimiter& operator=(const FrameLimiter&) = delete;
+
+		void setTargetFPS(float targetFPS);
+		float getTargetFPS() const;
+		void reset();
+		void wait();
+		std::optional<float> getLastPacingError() const;
+
+	private:
+		using Clock = std::chrono::steady_clock;
+
+		void sleepFor(Clock::duration duration) const;
+
+	private:
+		static constexpr std::chrono::microseconds k_spinThreshold = std::chrono::microseconds(1000);
+
+		void* m_timer = nullptr; // waitable timer HANDLE
+		float m_targetFPS = 0.0f;
+		Clock::duration m_frameDuration = Clock::duration::zero();
+		Clock::time_point m_deadline;
+		bool m_hasDeadline = false;
+		std::optional<float> m_lastPacingError;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,250 @@
+#include "HardwareCounters.h"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#endif
+
+namespace Engine::Utils
+{
+#ifdef __linux__
+	namespace
+	{
+		struct CounterConfig
+		{
+			uint32_t type;
+			uint64_t config;
+		};
+
+		constexpr uint64_t cacheMissConfig(uint64_t cache)
+		{
+			return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+		}
+
+		constexpr std::array<CounterConfig, HardwareCounters::k_countersCount> k_counterConfigs = { {
+			{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+			{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+			{ PERF_TYPE_HW_CACHE, cacheMissConfig(PERF_COUNT_HW_CACHE_L1D) },
+			{ PERF_TYPE_HW_CACHE, cacheMissConfig(PERF_COUNT_HW_CACHE_LL) },
+			{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+			{ PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CONTEXT_SWITCHES },
+		} };
+
+		int openCounter(const CounterConfig& counterConfig, int groupFd, bool excludeKernel)
+		{
+			perf_event_attr attr{};
+			attr.size = sizeof(attr);
+			attr.type = counterConfig.type;
+			attr.config = counterConfig.config;
+			attr.disabled = groupFd == -1 ? 1 : 0;
+			attr.exclude_kernel = excludeKernel ? 1 : 0;
+			attr.exclude_hv = 1;
+			attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+			return (int)syscall(SYS_perf_event_open, &attr, 0, -1, groupFd, 0);
+		}
+	}
+#endif
+
+	//////////////////////////////////////////////////////////////////////////
+
+	uint64_t HardwareCounters::Values::operator[](Counter counter) const
+	{
+		return counters[(size_t)counter];
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	HardwareCounters::Values& HardwareCounters::Values::operator+=(const Values& other)
+	{
+		for (size_t i = 0; i < k_countersCount; i++)
+		{
+			counters[i] += other.counters[i];
+		}
+		return *this;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	HardwareCounters::Values HardwareCounters::Reading::operator-(const Reading& previous) const
+	{
+		// counters are multiplexed when more are requested than the PMU has, the interval is scaled
+		// by its own enabled and running times, scaling the running totals would mix earlier intervals in
+		uint64_t enabled = timeEnabled > previous.timeEnabled ? timeEnabled - previous.timeEnabled : 0;
+		uint64_t running = timeRunning > previous.timeRunning ? timeRunning - previous.timeRunning : 0;
+		double scale = running > 0 && running < enabled ? (double)enabled / running : 1.0;
+
+		Values result;
+		for (size_t i = 0; i < k_countersCount; i++)
+		{
+			uint64_t count = raw.counters[i] > previous.raw.counters[i] ? raw.counters[i] - previous.raw.counters[i] : 0;
+			result.counters[i] = (uint64_t)(count * scale);
+		}
+		return result;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	HardwareCounters::HardwareCounters()
+	{
+		m_fds.fill(-1);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	HardwareCounters& HardwareCounters::get()
+	{
+		static HardwareCounters counters;
+		return counters;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	const char* HardwareCounters::getCounterName(Counter counter)
+	{
+		switch (counter)
+		{
+		case Counter::Cycles:
+			return "cycles";
+		case Counter::Instructions:
+			return "instructions";
+		case Counter::L1DataMisses:
+			return "L1 data misses";
+		case Counter::LastLevelCacheMisses:
+			return "LLC misses";
+		case Counter::BranchMisses:
+			return "branch misses";
+		case Counter::ContextSwitches:
+			return "context switches";
+		default:
+			return "unknown";
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	bool HardwareCounters::open()
+	{
+		close();
+
+#ifdef __linux__
+		// the counters are grouped so that a single read returns a consistent snapshot,
+		// whichever counter opens first leads the group
+		for (size_t i = 0; i < k_countersCount; i++)
+		{
+			int fd = openCounter(k_counterConfigs[i], m_groupFd, false);
+			if (fd == -1 && (errno == EACCES || errno == EPERM))
+			{
+				fd = openCounter(k_counterConfigs[i], m_groupFd, true);
+			}
+			if (fd == -1)
+			{
+				m_error += std::string(m_error.empty() ? "" : ", ") + getCounterName((Counter)i) + ": " + std::strerror(errno);
+				continue;
+			}
+
+			if (m_groupFd == -1)
+			{
+				m_groupFd = fd;
+			}
+			m_fds[i] = fd;
+			m_groupIndices[i] = m_groupSize++;
+		}
+
+		if (m_groupFd == -1)
+		{
+			return false;
+		}
+
+		ioctl(m_groupFd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+		ioctl(m_groupFd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+		return true;
+#else
+		m_error = "hardware counters are only supported on Linux";
+		return false;
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void HardwareCounters::close()
+	{
+#ifdef __linux__
+		for (int& fd : m_fds)
+		{
+			if (fd != -1)
+			{
+				::close(fd);
+			}
+			fd = -1;
+		}
+#endif
+		m_groupFd = -1;
+		m_groupSize = 0;
+		m_error.clear();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	bool HardwareCounters::isAvailable() const
+	{
+		return m_groupFd != -1;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	bool HardwareCounters::isCounterAvailable(Counter counter) const
+	{
+		return m_fds[(size_t)counter] != -1;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	const std::string& HardwareCounters::getError() const
+	{
+		return m_error;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	HardwareCounters::Reading HardwareCounters::read() const
+	{
+		Reading reading;
+#ifdef __linux__
+		if (m_groupFd == -1)
+		{
+			return reading;
+		}
+
+		// layout of a PERF_FORMAT_GROUP read: count, time enabled, time running, then the counter values
+		std::array<uint64_t, 3 + k_countersCount> buffer{};
+		if (::read(m_groupFd, buffer.data(), sizeof(buffer)) <= 0)
+		{
+			return reading;
+		}
+
+		reading.timeEnabled = buffer[1];
+		reading.timeRunning = buffer[2];
+		for (size_t i = 0; i < k_countersCount; i++)
+		{
+			if (m_fds[i] != -1)
+			{
+				reading.raw.counters[i] = buffer[3 + m_groupIndices[i]];
+			}
+		}
+#endif
+		return reading;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	HardwareCounters::~HardwareCounters()
+	{
+		close();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+}
\ No newline at end of file
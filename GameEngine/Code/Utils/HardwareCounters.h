@@ -0,0 +1,70 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+namespace Engine::Utils
+{
+	// Per-thread CPU counters read through perf_event_open. Only implemented on Linux, elsewhere
+	// and whenever the kernel refuses a counter (containers, perf_event_paranoid) it reads as unavailable.
+	class HardwareCounters
+	{
+	public:
+		enum class Counter
+		{
+			Cycles,
+			Instructions,
+			L1DataMisses,
+			LastLevelCacheMisses,
+			BranchMisses,
+			ContextSwitches,
+			Count
+		};
+
+		static constexpr size_t k_countersCount = (size_t)Counter::Count;
+
+		struct Values
+		{
+			std::array<uint64_t, k_countersCount> counters{};
+
+			uint64_t operator[](Counter counter) const;
+			Values& operator+=(const Values& other);
+		};
+
+		// raw group read, the counts only become comparable once scaled by the time they were running
+		struct Reading
+		{
+			Values raw;
+			uint64_t timeEnabled = 0;
+			uint64_t timeRunning = 0;
+
+			// scaled counts between two readings, clamped at zero
+			Values operator-(const Reading& previous) const;
+		};
+
+		static HardwareCounters& get();
+		static const char* getCounterName(Counter counter);
+
+		bool open();
+		void close();
+
+		bool isAvailable() const;
+		bool isCounterAvailable(Counter counter) const;
+		const std::string& getError() const;
+
+		Reading read() const;
+
+		~HardwareCounters();
+
+	private:
+		HardwareCounters();
+
+	private:
+		int m_groupFd = -1;
+		std::array<int, k_countersCount> m_fds;
+		std::array<size_t, k_countersCount> m_groupIndices{};
+		size_t m_groupSize = 0;
+		std::string m_error;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,147 @@
+#include "HdrHistogram.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace Engine::Utils
+{
+	//////////////////////////////////////////////////////////////////////////
+
+	void HdrHistogram::add(float value)
+	{
+		uint64_t nanoseconds = toNanoseconds(value);
+		m_buckets[getBucketIndex(nanoseconds)]++;
+		m_count++;
+		m_sum += value;
+		m_min = std::min(m_min, nanoseconds);
+		m_max = std::max(m_max, nanoseconds);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void HdrHistogram::remove(float value)
+	{
+		m_buckets[getBucketIndex(toNanoseconds(value))]--;
+		m_count--;
+		m_sum -= value;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void HdrHistogram::merge(const HdrHistogram& other)
+	{
+		for (size_t i = 0; i < k_bucketsCount; i++)
+		{
+			m_buckets[i] += other.m_buckets[i];
+		}
+		m_count += other.m_count;
+		m_sum += other.m_sum;
+		m_min = std::min(m_min, other.m_min);
+		m_max = std::max(m_max, other.m_max);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void HdrHistogram::clear()
+	{
+		m_buckets.fill(0);
+		m_count = 0;
+		m_sum = 0.0;
+		m_min = UINT64_MAX;
+		m_max = 0;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	size_t HdrHistogram::getCount() const
+	{
+		return m_count;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	float HdrHistogram::getMean() const
+	{
+		if (m_count == 0)
+		{
+			return 0.0f;
+		}
+		return (float)(m_sum / m_count);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	float HdrHistogram::getMin() const
+	{
+		return m_count > 0 ? 1e-9f * m_min : 0.0f;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	float HdrHistogram::getMax() const
+	{
+		return 1e-9f * m_max;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	float HdrHistogram::getPercentile(float percentile) const
+	{
+		if (m_count == 0)
+		{
+			return 0.0f;
+		}
+
+		size_t target = std::clamp<size_t>((size_t)std::ceil(percentile / 100.0 * m_count), 1, m_count);
+		size_t accumulated = 0;
+		for (size_t i = 0; i < k_bucketsCount; i++)
+		{
+			accumulated += m_buckets[i];
+			if (accumulated >= target)
+			{
+				// the exact extremes are known, so a bucket holding one of them doesn't widen the result
+				return 1e-9f * std::clamp(getBucketUpperBound(i), m_min, m_max);
+			}
+		}
+		return getMax();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	uint64_t HdrHistogram::toNanoseconds(float value)
+	{
+		return value > 0.0f ? std::min((uint64_t)std::llround(value * 1e9), k_maxValue) : 0;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	size_t HdrHistogram::getBucketIndex(uint64_t value)
+	{
+		if (value < k_subBucketsCount)
+		{
+			return (size_t)value;
+		}
+
+		// the top k_subBucketBits bits of the value select the bucket, the shift selects the power of two
+		size_t shift = std::bit_width(value) - k_subBucketBits;
+		size_t subBucket = (size_t)(value >> shift) - k_halfSubBucketsCount;
+		return k_subBucketsCount + (shift - 1) * k_halfSubBucketsCount + subBucket;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	uint64_t HdrHistogram::getBucketUpperBound(size_t index)
+	{
+		if (index < k_subBucketsCount)
+		{
+			return index;
+		}
+
+		size_t shift = (index - k_subBucketsCount) / k_halfSubBucketsCount + 1;
+		uint64_t subBucket = (index - k_subBucketsCount) % k_halfSubBucketsCount + k_halfSubBucketsCount;
+		return ((subBucket + 1) << shift) - 1;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+}
\ No newline at end of file
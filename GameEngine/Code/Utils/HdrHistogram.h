@@ -0,0 +1,48 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace Engine::Utils
+{
+	// Fixed-size log-linear histogram of durations in seconds. Values are counted in nanoseconds, exactly below
+	// k_subBucketsCount ns and in k_subBucketsCount / 2 linear steps per power of two above it, so a reported
+	// percentile is within 1 / (k_subBucketsCount / 2) of the recorded value. Inserting is O(1), two histograms
+	// can be merged and any percentile is read with one pass over the buckets.
+	class HdrHistogram
+	{
+	public:
+		void add(float value);
+		// takes back a value that was added, the minimum and maximum stay where they were
+		void remove(float value);
+		void merge(const HdrHistogram& other);
+		void clear();
+
+		size_t getCount() const;
+		float getMean() const;
+		float getMin() const;
+		float getMax() const;
+		float getPercentile(float percentile) const;
+
+	private:
+		static uint64_t toNanoseconds(float value);
+		static size_t getBucketIndex(uint64_t value);
+		static uint64_t getBucketUpperBound(size_t index);
+
+	private:
+		static constexpr size_t k_subBucketBits = 8;
+		static constexpr size_t k_subBucketsCount = 1 << k_subBucketBits;
+		static constexpr size_t k_halfSubBucketsCount = k_subBucketsCount / 2;
+		// values above 2^k_maxValueBits ns, about 18 minutes, are counted as that
+		static constexpr size_t k_maxValueBits = 40;
+		static constexpr uint64_t k_maxValue = ((uint64_t)1 << k_maxValueBits) - 1;
+		static constexpr size_t k_bucketsCount = k_subBucketsCount + (k_maxValueBits - k_subBucketBits) * k_halfSubBucketsCount;
+
+		std::array<uint64_t, k_bucketsCount> m_buckets{};
+		size_t m_count = 0;
+		double m_sum = 0.0;
+		uint64_t m_min = UINT64_MAX;
+		uint64_t m_max = 0;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,22 @@
+#include "IMetricsProvider.h"
+
+#include "PdhMetricsProvider.h"
+#include "ProcMetricsProvider.h"
+
+namespace Engine::Utils
+{
+	//////////////////////////////////////////////////////////////////////////
+
+	std::unique_ptr<IMetricsProvider> IMetricsProvider::create()
+	{
+#ifdef _WIN32
+		return std::make_unique<PdhMetricsProvider>();
+#elif defined(__linux__)
+		return std::make_unique<ProcMetricsProvider>();
+#else
+		return nullptr;
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+}
\ No newline at end of file
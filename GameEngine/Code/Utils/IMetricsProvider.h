@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace Engine::Utils
+{
+	struct ThreadCpuUsage
+	{
+		uint64_t id;
+		// empty where threads aren't named
+		std::string name;
+		bool mainThread;
+		// percent of one core since the previous sample
+		float cpuUsage;
+		// seconds since the thread started
+		float cpuTime;
+	};
+
+	// Usage values are averaged over the time since the previous sample, counts are totals since the process started.
+	// Values a platform can't provide are left empty.
+	struct MetricsSample
+	{
+		// percent of all cores
+		float cpuUsage = 0.0f;
+		float processCpuUsage = 0.0f;
+		// MB
+		float memoryUsage = 0.0f;
+		float peakMemoryUsage = 0.0f;
+		std::optional<float> gpuUsage;
+		std::optional<float> gpuMemoryUsage;
+		uint64_t pageFaults = 0;
+		std::optional<uint64_t> majorPageFaults;
+		std::optional<uint64_t> voluntaryContextSwitches;
+		std::optional<uint64_t> involuntaryContextSwitches;
+		std::vector<ThreadCpuUsage> threads;
+	};
+
+	// Process and system counters behind one interface, so the stats can be collected on every platform we benchmark on.
+	class IMetricsProvider
+	{
+	public:
+		// the provider for the current platform or nullptr if there is none, the thread calling open() is reported as the main thread
+		static std::unique_ptr<IMetricsProvider> create();
+
+		virtual bool open() = 0;
+		virtual void close() = 0;
+		virtual bool sample(MetricsSample& sample) = 0;
+
+		virtual ~IMetricsProvider() = default;
+	};
+}
\ No newline at end of file
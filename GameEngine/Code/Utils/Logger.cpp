@@ -0,0 +1,315 @@
+#include "Logger.h"
+
+#include <algorithm>
+#include <cstring>
+#include <format>
+#include <iostream>
+
+namespace Engine::Utils
+{
+	//////////////////////////////////////////////////////////////////////////
+
+	Logger& Logger::get()
+	{
+		static Logger logger;
+		return logger;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	Logger::Logger(): m_startTime(Clock::now())
+	{
+		m_thread = std::thread(&Logger::run, this);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	Logger::~Logger()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_threadMutex);
+			m_stop = true;
+		}
+		m_threadCondition.notify_one();
+		if (m_thread.joinable())
+		{
+			m_thread.join();
+		}
+
+		writeRecords();
+		size_t droppedRecords = getDroppedRecordsCount();
+		if (droppedRecords > 0)
+		{
+			std::cout << "Logger dropped " << droppedRecords << " records" << std::endl;
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void Logger::flush()
+	{
+		writeRecords();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	size_t Logger::getDroppedRecordsCount() const
+	{
+		return m_droppedRecords.load(std::memory_order_relaxed);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void Logger::Record::addString(std::string_view value)
+	{
+		// strings are copied, the caller's buffer may be gone by the time the record is written
+		Arg& arg = args[argsCount++];
+		if (value.size() <= k_stringsSize - stringsSize)
+		{
+			std::memcpy(strings.data() + stringsSize, value.data(), value.size());
+			arg.type = ArgType::String;
+			arg.string.offset = stringsSize;
+			arg.string.size = static_cast<uint32_t>(value.size());
+			stringsSize += static_cast<uint32_t>(value.size());
+			return;
+		}
+
+		// long strings such as shader and validation logs don't fit the record and are moved to the heap
+		char* data = new char[value.size()];
+		std::memcpy(data, value.data(), value.size());
+		arg.type = ArgType::HeapString;
+		arg.heapString.data = data;
+		arg.heapString.size = value.size();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void Logger::Record::releaseStrings() const
+	{
+		for (uint32_t i = 0; i < argsCount; i++)
+		{
+			if (args[i].type == ArgType::HeapString)
+			{
+				delete[] args[i].heapString.data;
+			}
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void Logger::push(const Record& record)
+	{
+		// a full ring drops the record instead of blocking the caller
+		if (!getThreadQueue().push(record))
+		{
+			record.releaseStrings();
+			m_droppedRecords.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void Logger::writeNow(const Record& record)
+	{
+		// what was logged before is written first so the output keeps its order
+		writeRecords();
+
+		std::lock_guard<std::mutex> writeLock(m_writeMutex);
+		std::cout << formatRecord(record) << std::endl;
+		record.releaseStrings();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	Logger::RecordsQueue& Logger::getThreadQueue()
+	{
+		// queues outlive their threads so records pushed right before a thread exits are still written
+		thread_local RecordsQueue* threadQueue = nullptr;
+		if (threadQueue != nullptr)
+		{
+			return *threadQueue;
+		}
+
+		auto queue = std::make_unique<RecordsQueue>();
+		threadQueue = queue.get();
+
+		std::lock_guard<std::mutex> lock(m_queuesMutex);
+		m_queues.push_back(std::move(queue));
+		return *threadQueue;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void Logger::run()
+	{
+		std::unique_lock<std::mutex> lock(m_threadMutex);
+		while (!m_stop)
+		{
+			m_threadCondition.wait_for(lock, k_writeInterval, [this]() { return m_stop; });
+			lock.unlock();
+			writeRecords();
+			lock.lock();
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void Logger::writeRecords()
+	{
+		std::lock_guard<std::mutex> writeLock(m_writeMutex);
+
+		{
+			std::lock_guard<std::mutex> queuesLock(m_queuesMutex);
+			Record record;
+			for (const std::unique_ptr<RecordsQueue>& queue : m_queues)
+			{
+				while (queue->pop(record))
+				{
+					m_pendingRecords.push_back(record);
+				}
+			}
+		}
+
+		if (m_pendingRecords.empty())
+		{
+			return;
+		}
+
+		std::sort(m_pendingRecords.begin(), m_pendingRecords.end(),
+			[](const Record& first, const Record& second) { return first.timestamp < second.timestamp; });
+
+		std::string output;
+		for (const Record& record : m_pendingRecords)
+		{
+			output += formatRecord(record);
+			output += '\n';
+			record.releaseStrings();
+		}
+		m_pendingRecords.clear();
+
+		std::cout << output << std::flush;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	std::string Logger::formatRecord(const Record& record) const
+	{
+		const LogSite& site = *record.site;
+		switch (site.level)
+		{
+		case LogLevel::AssertFailed:
+			return std::format("Assertion failed: ({}), file {}, line {}.\nMessage: {}",
+				site.condition, site.file, site.line, formatMessage(record, 0));
+		case LogLevel::OpenGLError:
+			return std::format("OpenGL error check failed: error code=({}), file {}, line {}.\nMessage: {}",
+				formatArg(record, record.args[0], ""), site.file, site.line, formatMessage(record, 1));
+		case LogLevel::OpenGLFrameError:
+			return std::format("OpenGL error check failed: error code=({}) during the frame, last checked call at file {}, line {}, the calls are checked one by one next frame.\nMessage: {}",
+				formatArg(record, record.args[0], ""), site.file, site.line, site.format);
+		default:
+			return std::format("[{:.3f} ms] {}", record.timestamp / 1e6, formatMessage(record, 0));
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	std::string Logger::formatMessage(const Record& record, size_t firstArg) const
+	{
+		// the format string is walked here instead of at the call site, each replacement field
+		// is formatted on its own with the spec it was written with
+		std::string result;
+		size_t argIndex = firstArg;
+		for (const char* c = record.site->format; *c != '\0'; ++c)
+		{
+			if ((*c == '{' && c[1] == '{') || (*c == '}' && c[1] == '}'))
+			{
+				result += *c;
+				++c;
+				continue;
+			}
+
+			if (*c != '{')
+			{
+				result += *c;
+				continue;
+			}
+
+			const char* end = std::strchr(c, '}');
+			if (end == nullptr)
+			{
+				result += c;
+				break;
+			}
+
+			std::string_view field(c + 1, end - c - 1);
+			size_t specStart = field.find(':');
+			std::string_view spec = specStart == std::string_view::npos ? std::string_view() : field.substr(specStart);
+			if (argIndex < record.argsCount)
+			{
+				result += formatArg(record, record.args[argIndex++], spec);
+			}
+			c = end;
+		}
+
+		return result;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	std::string Logger::formatArg(const Record& record, const Arg& arg, std::string_view spec)
+	{
+		std::string format = "{";
+		format += spec;
+		format += "}";
+
+		try
+		{
+			switch (arg.type)
+			{
+			case ArgType::Bool:
+			{
+				bool value = arg.unsignedValue != 0;
+				return std::vformat(format, std::make_format_args(value));
+			}
+			case ArgType::Char:
+			{
+				char value = static_cast<char>(arg.signedValue);
+				return std::vformat(format, std::make_format_args(value));
+			}
+			case ArgType::Signed:
+				return std::vformat(format, std::make_format_args(arg.signedValue));
+			case ArgType::Unsigned:
+				return std::vformat(format, std::make_format_args(arg.unsignedValue));
+			case ArgType::Float:
+				return std::vformat(format, std::make_format_args(arg.floatValue));
+			case ArgType::String:
+			{
+				std::string_view value(record.strings.data() + arg.string.offset, arg.string.size);
+				return std::vformat(format, std::make_format_args(value));
+			}
+			case ArgType::HeapString:
+			{
+				std::string_view value(arg.heapString.data, arg.heapString.size);
+				return std::vformat(format, std::make_format_args(value));
+			}
+			case ArgType::Pointer:
+			{
+				const void* value = reinterpret_cast<const void*>(arg.unsignedValue);
+				return std::vformat(format, std::make_format_args(value));
+			}
+			}
+		}
+		catch (const std::format_error&)
+		{
+			// a spec that does not fit the stored type, e.g. a string with a float spec
+			if (!spec.empty())
+			{
+				return formatArg(record, arg, "");
+			}
+		}
+
+		return {};
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+}
\ No newline at end of file
@@ -0,0 +1,163 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "SPSCQueue.h"
+
+namespace Engine::Utils
+{
+	enum class LogLevel
+	{
+		Info,
+		AssertFailed,
+		OpenGLError,
+		OpenGLFrameError
+	};
+
+	// Everything about a log call that is known at compile time, a call site keeps one as a static
+	// and records only point to it, so the format string is never copied on the logging thread.
+	struct LogSite
+	{
+		LogLevel level;
+		const char* format;
+		const char* condition;
+		const char* file;
+		int line;
+	};
+
+	// Call sites push compact records (site + raw arguments) into a ring owned by their thread,
+	// a background thread formats them in timestamp order and writes them to stdout.
+	class Logger
+	{
+	public:
+		using Clock = std::chrono::steady_clock;
+
+		static Logger& get();
+
+		template <typename... Args>
+		void log(const LogSite& site, const Args&... args);
+
+		// formats and writes the message before returning, for failures that stop in the debugger
+		// and whose record could otherwise be dropped by a full ring
+		template <typename... Args>
+		void logSync(const LogSite& site, const Args&... args);
+
+		// blocks until every record pushed before the call is written
+		void flush();
+
+		size_t getDroppedRecordsCount() const;
+
+		static void setLastOpenGLSite(const LogSite& site);
+		static const LogSite* getLastOpenGLSite();
+		// with _BATCH_OPENGL_ERRORS, set for the frame after an error so each call is checked again
+		static void setCheckOpenGLCalls(bool check);
+		static bool shouldCheckOpenGLCalls();
+
+		~Logger();
+
+	private:
+		static constexpr size_t k_maxArgs = 8;
+		static constexpr size_t k_stringsSize = 128;
+		static constexpr size_t k_recordsPerThread = 1 << 10;
+		static constexpr std::chrono::milliseconds k_writeInterval = std::chrono::milliseconds(10);
+
+		enum class ArgType: uint8_t
+		{
+			Bool,
+			Char,
+			Signed,
+			Unsigned,
+			Float,
+			String,
+			HeapString,
+			Pointer
+		};
+
+		struct Arg
+		{
+			ArgType type;
+			union
+			{
+				int64_t signedValue;
+				uint64_t unsignedValue;
+				double floatValue;
+				struct
+				{
+					uint32_t offset;
+					uint32_t size;
+				} string;
+				struct
+				{
+					const char* data;
+					size_t size;
+				} heapString;
+			};
+		};
+
+		struct Record
+		{
+			const LogSite* site;
+			uint64_t timestamp;
+			uint32_t argsCount;
+			uint32_t stringsSize;
+			std::array<Arg, k_maxArgs> args;
+			std::array<char, k_stringsSize> strings;
+
+			template <typename T>
+			void add(const T& value);
+			void addString(std::string_view value);
+			// frees the strings that did not fit in the record, once it is written or dropped
+			void releaseStrings() const;
+		};
+
+		using RecordsQueue = SPSCQueue<Record, k_recordsPerThread>;
+
+	private:
+		Logger();
+
+		template <typename... Args>
+		Record makeRecord(const LogSite& site, const Args&... args) const;
+		void push(const Record& record);
+		void writeNow(const Record& record);
+		RecordsQueue& getThreadQueue();
+		void run();
+		void writeRecords();
+		std::string formatRecord(const Record& record) const;
+		std::string formatMessage(const Record& record, size_t firstArg) const;
+		static std::string formatArg(const Record& record, const Arg& arg, std::string_view spec);
+
+	private:
+		std::mutex m_queuesMutex;
+		std::vector<std::unique_ptr<RecordsQueue>> m_queues;
+
+		// the queues have a single consumer, whichever thread writes holds this mutex
+		std::mutex m_writeMutex;
+		std::vector<Record> m_pendingRecords;
+
+		std::atomic<size_t> m_droppedRecords = 0;
+		Clock::time_point m_startTime;
+
+		std::thread m_thread;
+		std::mutex m_threadMutex;
+		std::condition_variable m_threadCondition;
+		bool m_stop = false;
+	};
+}
+
+#define LOG_INFO(message, ...) \
+    do { \
+        static constexpr Engine::Utils::LogSite logSite{ Engine::Utils::LogLevel::Info, message, nullptr, __FILE__, __LINE__ }; \
+        Engine::Utils::Logger::get().log(logSite, ##__VA_ARGS__); \
+    } while (false)
+
+#include "Logger.inl"
\ No newline at end of file
@@ -0,0 +1,138 @@
+#pragma once
+
+#include "Logger.h"
+
+#include <type_traits>
+
+namespace Engine::Utils
+{
+	//////////////////////////////////////////////////////////////////////////
+
+	template <typename... Args>
+	void Logger::log(const LogSite& site, const Args&... args)
+	{
+		push(makeRecord(site, args...));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	template <typename... Args>
+	void Logger::logSync(const LogSite& site, const Args&... args)
+	{
+		writeNow(makeRecord(site, args...));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	template <typename... Args>
+	Logger::Record Logger::makeRecord(const LogSite& site, const Args&... args) const
+	{
+		static_assert(sizeof...(Args) <= k_maxArgs, "Too many log arguments");
+
+		Record record;
+		record.site = &site;
+		record.timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - m_startTime).count();
+		record.argsCount = 0;
+		record.stringsSize = 0;
+		(record.add(args), ...);
+		return record;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	template <typename T>
+	void Logger::Record::add(const T& value)
+	{
+		if constexpr (std::is_enum_v<T>)
+		{
+			add(static_cast<std::underlying_type_t<T>>(value));
+			return;
+		}
+		else if constexpr (std::is_convertible_v<const T&, std::string_view>)
+		{
+			addString(std::string_view(value));
+			return;
+		}
+		else
+		{
+			Arg& arg = args[argsCount++];
+			if constexpr (std::is_same_v<T, bool>)
+			{
+				arg.type = ArgType::Bool;
+				arg.unsignedValue = value;
+			}
+			else if constexpr (std::is_same_v<T, char>)
+			{
+				arg.type = ArgType::Char;
+				arg.signedValue = value;
+			}
+			else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>)
+			{
+				arg.type = ArgType::Signed;
+				arg.signedValue = value;
+			}
+			else if constexpr (std::is_integral_v<T>)
+			{
+				arg.type = ArgType::Unsigned;
+				arg.unsignedValue = value;
+			}
+			else if constexpr (std::is_floating_point_v<T>)
+			{
+				arg.type = ArgType::Float;
+				arg.floatValue = value;
+			}
+			else
+			{
+				static_assert(std::is_pointer_v<T>, "Unsupported log argument type");
+				arg.type = ArgType::Pointer;
+				arg.unsignedValue = reinterpret_cast<uintptr_t>(value);
+			}
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	inline const LogSite*& lastOpenGLSite()
+	{
+		thread_local const LogSite* site = nullptr;
+		return site;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	inline void Logger::setLastOpenGLSite(const LogSite& site)
+	{
+		lastOpenGLSite() = &site;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	inline const LogSite* Logger::getLastOpenGLSite()
+	{
+		return lastOpenGLSite();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	inline bool& checkOpenGLCalls()
+	{
+		thread_local bool check = false;
+		return check;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	inline void Logger::setCheckOpenGLCalls(bool check)
+	{
+		checkOpenGLCalls() = check;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	inline bool Logger::shouldCheckOpenGLCalls()
+	{
+		return checkOpenGLCalls();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+}
\ No newline at end of file
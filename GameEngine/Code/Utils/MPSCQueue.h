@@ -0,0 +1,46 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+
+namespace Engine::Utils
+{
+	// Bounded multi-producer single-consumer ring (Vyukov). Every cell carries a sequence
+	// number, so producers only contend on the enqueue position and never block the consumer.
+	template <typename T>
+	class MPSCQueue
+	{
+	public:
+		explicit MPSCQueue(size_t capacity);
+
+		MPSCQueue(const MPSCQueue&) = delete;
+		MPSCQueue& operator=(const MPSCQueue&) = delete;
+
+		bool push(const T& value);
+		bool push(T&& value);
+		bool pop(T& value);
+		size_t capacity() const;
+
+	private:
+		struct Cell
+		{
+			std::atomic<size_t> sequence;
+			T data;
+		};
+
+		template <typename U>
+		bool emplace(U&& value);
+
+	private:
+		static constexpr size_t k_cacheLineSize = 64;
+
+		std::unique_ptr<Cell[]> m_buffer;
+		size_t m_mask;
+		alignas(k_cacheLineSize) std::atomic<size_t> m_enqueuePosition = 0;
+		alignas(k_cacheLineSize) size_t m_dequeuePosition = 0;
+	};
+}
+
+#include "MPSCQueue.inl"
\ No newline at end of file
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "MPSCQueue.h"
+
+namespace Engine::Utils
+{
+	//////////////////////////////////////////////////////////////////////////
+
+	template <typename T>
+	MPSCQueue<T>::MPSCQueue(size_t capacity)
+	{
+		size_t roundedCapacity = 2;
+		while (roundedCapacity < capacity)
+		{
+			roundedCapacity <<= 1;
+		}
+
+		m_buffer = std::make_unique<Cell[]>(roundedCapacity);
+		m_mask = roundedCapacity - 1;
+		for (size_t i = 0; i < roundedCapacity; i++)
+		{
+			m_buffer[i].sequence.store(i, std::memory_order_relaxed);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	template <typename T>
+	bool MPSCQueue<T>::push(const T& value)
+	{
+		return emplace(value);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	template <typename T>
+	bool MPSCQueue<T>::push(T&& value)
+	{
+		return emplace(std::move(value));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	template <typename T>
+	template <typename U>
+	bool MPSCQueue<T>::emplace(U&& value)
+	{
+		size_t position = m_enqueuePosition.load(std::memory_order_relaxed);
+		while (true)
+		{
+			Cell& cell = m_buffer[position & m_mask];
+			size_t sequence = cell.sequence.load(std::memory_order_acquire);
+			intptr_t difference = (intptr_t)sequence - (intptr_t)position;
+			if (difference == 0)
+			{
+				if (m_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+				{
+					cell.data = std::forward<U>(value);
+					cell.sequence.store(position + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			else if (difference < 0)
+			{
+				return false;
+			}
+			else
+			{
+				position = m_enqueuePosition.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	template <typename T>
+	bool MPSCQueue<T>::pop(T& value)
+	{
+		Cell& cell = m_buffer[m_dequeuePosition & m_mask];
+		size_t sequence = cell.sequence.load(std::memory_order_acquire);
+		if ((intptr_t)sequence - (intptr_t)(m_dequeuePosition + 1) < 0)
+		{
+			return false;
+		}
+
+		value = std::move(cell.data);
+		cell.sequence.store(m_dequeuePosition + m_mask + 1, std::memory_order_release);
+		m_dequeuePosition++;
+		return true;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	template <typename T>
+	size_t MPSCQueue<T>::capacity() const
+	{
+		return m_mask + 1;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+}
\ No newline at end of file
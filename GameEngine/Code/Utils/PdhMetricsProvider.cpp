@@ -0,0 +1,196 @@
+#include "PdhMetricsProvider.h"
+
+#ifdef _WIN32
+
+#include <thread>
+#include <psapi.h>
+#include <tlhelp32.h>
+
+#include "DebugMacros.h"
+
+namespace Engine::Utils
+{
+	//////////////////////////////////////////////////////////////////////////
+
+	bool PdhMetricsProvider::open()
+	{
+		m_mainThreadId = GetCurrentThreadId();
+		unsigned int coresCount = std::thread::hardware_concurrency();
+		m_coresCount = coresCount > 0 ? coresCount : 1;
+
+		PDH_STATUS cpuOpenRes = PdhOpenQuery(nullptr, 0, &m_cpuQuery);
+		ASSERT(cpuOpenRes == ERROR_SUCCESS, "Failed to open CPU query");
+		PDH_STATUS cpuAddRes = PdhAddCounter(m_cpuQuery, TEXT("\\Processor(_Total)\\% Processor Time"), 0, &m_cpuUsageCounter);
+		ASSERT(cpuAddRes == ERROR_SUCCESS, "Failed to add CPU counter");
+
+		PDH_STATUS cpuCollectRes = PdhCollectQueryData(m_cpuQuery);
+		ASSERT(cpuCollectRes == ERROR_SUCCESS, "Failed to collect CPU query data");
+
+		PDH_STATUS gpuOpenRes = PdhOpenQuery(nullptr, 0, &m_gpuUsageQuery);
+		ASSERT(gpuOpenRes == ERROR_SUCCESS, "Failed to open GPU query");
+		PDH_STATUS gpuAddRes = PdhAddCounter(m_gpuUsageQuery, TEXT("\\GPU Engine(*_3D)\\Utilization Percentage"), 0, &m_gpuUsageCounter);
+		ASSERT(gpuAddRes == ERROR_SUCCESS, "Failed to add GPU counter");
+
+		PDH_STATUS gpuCollectRes = PdhCollectQueryData(m_gpuUsageQuery);
+		ASSERT(gpuCollectRes == ERROR_SUCCESS, "Failed to collect GPU query data");
+
+		PDH_STATUS gpuMemoryOpenRes = PdhOpenQuery(nullptr, 0, &m_gpuMemoryUsageQuery);
+		ASSERT(gpuMemoryOpenRes == ERROR_SUCCESS, "Failed to open GPU query");
+		PDH_STATUS gpuAddMemoryRes = PdhAddCounter(m_gpuMemoryUsageQuery, TEXT("\\GPU Process Memory(*)\\Dedicated Usage"), 0, &m_gpuMemoryUsageCounter);
+		ASSERT(gpuAddMemoryRes == ERROR_SUCCESS, "Failed to add GPU counter");
+
+		PDH_STATUS gpuMemoryCollectRes = PdhCollectQueryData(m_gpuMemoryUsageQuery);
+		ASSERT(gpuMemoryCollectRes == ERROR_SUCCESS, "Failed to collect GPU query data");
+
+		FILETIME creationTime, exitTime, kernelTime, userTime;
+		if (GetProcessTimes(GetCurrentProcess(), &creationTime, &exitTime, &kernelTime, &userTime))
+		{
+			m_lastProcessTicks = toTicks(kernelTime) + toTicks(userTime);
+		}
+		m_lastSampleTime = Clock::now();
+		MetricsSample sample;
+		sampleThreads(sample, 0.0f);
+
+		return cpuCollectRes == ERROR_SUCCESS;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void PdhMetricsProvider::close()
+	{
+		PdhCloseQuery(m_gpuUsageQuery);
+		PdhCloseQuery(m_cpuQuery);
+		PdhCloseQuery(m_gpuMemoryUsageQuery);
+		m_lastThreadTicks.clear();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	bool PdhMetricsProvider::sample(MetricsSample& sample)
+	{
+		Clock::time_point now = Clock::now();
+		float elapsedTicks = std::chrono::duration<float>(now - m_lastSampleTime).count() * k_ticksPerSecond;
+		m_lastSampleTime = now;
+
+		sample.cpuUsage = (float)readCounter(m_cpuQuery, m_cpuUsageCounter).value_or(0.0);
+		sample.gpuUsage = readCounter(m_gpuUsageQuery, m_gpuUsageCounter);
+		std::optional<double> gpuMemoryUsage = readCounter(m_gpuMemoryUsageQuery, m_gpuMemoryUsageCounter);
+		if (gpuMemoryUsage)
+		{
+			sample.gpuMemoryUsage = (float)(*gpuMemoryUsage / (1024.0 * 1024.0));
+		}
+
+		FILETIME creationTime, exitTime, kernelTime, userTime;
+		if (GetProcessTimes(GetCurrentProcess(), &creationTime, &exitTime, &kernelTime, &userTime))
+		{
+			uint64_t processTicks = toTicks(kernelTime) + toTicks(userTime);
+			if (elapsedTicks > 0.0f)
+			{
+				sample.processCpuUsage = 100.0f * (processTicks - m_lastProcessTicks) / (elapsedTicks * m_coresCount);
+			}
+			m_lastProcessTicks = processTicks;
+		}
+
+		PROCESS_MEMORY_COUNTERS memCounter;
+		if (GetProcessMemoryInfo(GetCurrentProcess(), &memCounter, sizeof(memCounter)))
+		{
+			sample.memoryUsage = memCounter.WorkingSetSize / (1024.0f * 1024.0f);
+			sample.peakMemoryUsage = memCounter.PeakWorkingSetSize / (1024.0f * 1024.0f);
+			// soft and hard faults are counted together
+			sample.pageFaults = memCounter.PageFaultCount;
+		}
+
+		sampleThreads(sample, elapsedTicks);
+		return true;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	std::optional<double> PdhMetricsProvider::readCounter(PDH_HQUERY query, PDH_HCOUNTER counter)
+	{
+		PDH_STATUS res = PdhCollectQueryData(query);
+		ASSERT(res == ERROR_SUCCESS, "Failed to collect query data");
+		if (res != ERROR_SUCCESS)
+		{
+			return std::nullopt;
+		}
+
+		PDH_FMT_COUNTERVALUE counterVal;
+		res = PdhGetFormattedCounterValue(counter, PDH_FMT_DOUBLE, nullptr, &counterVal);
+		ASSERT(res == ERROR_SUCCESS, "Failed to format query data");
+		if (res != ERROR_SUCCESS)
+		{
+			return std::nullopt;
+		}
+
+		return counterVal.doubleValue;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	uint64_t PdhMetricsProvider::toTicks(const FILETIME& time)
+	{
+		return ((uint64_t)time.dwHighDateTime << 32) | time.dwLowDateTime;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void PdhMetricsProvider::sampleThreads(MetricsSample& sample, float elapsedTicks)
+	{
+		HANDLE snapshot = CreateToolhelp32Snapshot(TH32CS_SNAPTHREAD, 0);
+		if (snapshot == INVALID_HANDLE_VALUE)
+		{
+			return;
+		}
+
+		std::unordered_map<DWORD, uint64_t> threadTicks;
+		DWORD processId = GetCurrentProcessId();
+		THREADENTRY32 entry{};
+		entry.dwSize = sizeof(entry);
+		for (BOOL found = Thread32First(snapshot, &entry); found; found = Thread32Next(snapshot, &entry))
+		{
+			if (entry.th32OwnerProcessID != processId)
+			{
+				continue;
+			}
+
+			HANDLE thread = OpenThread(THREAD_QUERY_LIMITED_INFORMATION, FALSE, entry.th32ThreadID);
+			if (thread == nullptr)
+			{
+				continue;
+			}
+
+			FILETIME creationTime, exitTime, kernelTime, userTime;
+			BOOL timesRead = GetThreadTimes(thread, &creationTime, &exitTime, &kernelTime, &userTime);
+			CloseHandle(thread);
+			if (!timesRead)
+			{
+				continue;
+			}
+
+			uint64_t ticks = toTicks(kernelTime) + toTicks(userTime);
+			threadTicks[entry.th32ThreadID] = ticks;
+
+			// threads that started after the previous sample are reported from the next one
+			auto lastTicks = m_lastThreadTicks.find(entry.th32ThreadID);
+			if (lastTicks == m_lastThreadTicks.end() || elapsedTicks <= 0.0f)
+			{
+				continue;
+			}
+
+			ThreadCpuUsage usage;
+			usage.id = entry.th32ThreadID;
+			usage.mainThread = entry.th32ThreadID == m_mainThreadId;
+			usage.cpuUsage = 100.0f * (ticks - lastTicks->second) / elapsedTicks;
+			usage.cpuTime = ticks / k_ticksPerSecond;
+			sample.threads.push_back(std::move(usage));
+		}
+		CloseHandle(snapshot);
+
+		m_lastThreadTicks = std::move(threadTicks);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,49 @@
+#pragma once
+
+#ifdef _WIN32
+
+#include <chrono>
+#include <unordered_map>
+#include <Windows.h>
+#include <pdh.h>
+
+#include "IMetricsProvider.h"
+
+namespace Engine::Utils
+{
+	// System and GPU load from PDH counters, process memory and thread times from the process APIs.
+	// Context switch counts aren't exposed per process there and are left empty.
+	class PdhMetricsProvider: public IMetricsProvider
+	{
+	public:
+		bool open() override;
+		void close() override;
+		bool sample(MetricsSample& sample) override;
+
+	private:
+		using Clock = std::chrono::steady_clock;
+
+		static std::optional<double> readCounter(PDH_HQUERY query, PDH_HCOUNTER counter);
+		static uint64_t toTicks(const FILETIME& time);
+		void sampleThreads(MetricsSample& sample, float elapsedTicks);
+
+	private:
+		static constexpr float k_ticksPerSecond = 1e7f;
+
+		PDH_HQUERY m_gpuUsageQuery = nullptr;
+		PDH_HCOUNTER m_gpuUsageCounter = nullptr;
+		PDH_HQUERY m_gpuMemoryUsageQuery = nullptr;
+		PDH_HCOUNTER m_gpuMemoryUsageCounter = nullptr;
+		PDH_HQUERY m_cpuQuery = nullptr;
+		PDH_HCOUNTER m_cpuUsageCounter = nullptr;
+
+		DWORD m_mainThreadId = 0;
+		unsigned int m_coresCount = 1;
+
+		Clock::time_point m_lastSampleTime;
+		uint64_t m_lastProcessTicks = 0;
+		std::unordered_map<DWORD, uint64_t> m_lastThreadTicks;
+	};
+}
+
+#endif
\ No newline at end of file
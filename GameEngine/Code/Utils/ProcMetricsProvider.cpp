@@ -0,0 +1,229 @@
+#include "ProcMetricsProvider.h"
+
+#ifdef __linux__
+
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string_view>
+#include <thread>
+#include <unistd.h>
+
+namespace Engine::Utils
+{
+	//////////////////////////////////////////////////////////////////////////
+
+	bool ProcMetricsProvider::open()
+	{
+		m_mainThreadId = (int)gettid();
+		long ticksPerSecond = sysconf(_SC_CLK_TCK);
+		m_ticksPerSecond = ticksPerSecond > 0 ? (float)ticksPerSecond : 100.0f;
+		unsigned int coresCount = std::thread::hardware_concurrency();
+		m_coresCount = coresCount > 0 ? coresCount : 1;
+
+		// the first sample is measured against the counters at this point
+		ProcessStat processStat;
+		if (!readSystemTicks(m_lastSystemTicks) || !readProcessStat("/proc/self/stat", processStat))
+		{
+			return false;
+		}
+
+		m_lastProcessTicks = processStat.cpuTicks;
+		m_lastSampleTime = Clock::now();
+		MetricsSample sample;
+		sampleThreads(sample, 0.0f);
+		return true;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void ProcMetricsProvider::close()
+	{
+		m_lastThreadTicks.clear();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	bool ProcMetricsProvider::sample(MetricsSample& sample)
+	{
+		SystemTicks systemTicks;
+		ProcessStat processStat;
+		if (!readSystemTicks(systemTicks) || !readProcessStat("/proc/self/stat", processStat))
+		{
+			return false;
+		}
+
+		Clock::time_point now = Clock::now();
+		float elapsedTicks = std::chrono::duration<float>(now - m_lastSampleTime).count() * m_ticksPerSecond;
+		m_lastSampleTime = now;
+
+		uint64_t totalTicks = systemTicks.total - m_lastSystemTicks.total;
+		if (totalTicks > 0)
+		{
+			sample.cpuUsage = 100.0f * (systemTicks.busy - m_lastSystemTicks.busy) / totalTicks;
+		}
+		m_lastSystemTicks = systemTicks;
+
+		if (elapsedTicks > 0.0f)
+		{
+			sample.processCpuUsage = 100.0f * (processStat.cpuTicks - m_lastProcessTicks) / (elapsedTicks * m_coresCount);
+		}
+		m_lastProcessTicks = processStat.cpuTicks;
+
+		sample.pageFaults = processStat.minorFaults + processStat.majorFaults;
+		sample.majorPageFaults = processStat.majorFaults;
+		readStatus(sample);
+		sampleThreads(sample, elapsedTicks);
+		return true;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	bool ProcMetricsProvider::readSystemTicks(SystemTicks& ticks)
+	{
+		// cpu user nice system idle iowait irq softirq steal, guest time is already part of user
+		std::ifstream statFile("/proc/stat");
+		std::string label;
+		statFile >> label;
+		if (label != "cpu")
+		{
+			return false;
+		}
+
+		uint64_t values[8] = {};
+		for (uint64_t& value : values)
+		{
+			statFile >> value;
+		}
+		if (!statFile)
+		{
+			return false;
+		}
+
+		uint64_t idle = values[3] + values[4];
+		ticks.total = 0;
+		for (uint64_t value : values)
+		{
+			ticks.total += value;
+		}
+		ticks.busy = ticks.total - idle;
+		return true;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	bool ProcMetricsProvider::readProcessStat(const std::string& path, ProcessStat& stat)
+	{
+		std::ifstream statFile(path);
+		std::string line;
+		if (!std::getline(statFile, line))
+		{
+			return false;
+		}
+
+		// the command name may contain spaces, the numeric fields start after its closing parenthesis
+		size_t commEnd = line.rfind(')');
+		if (commEnd == std::string::npos)
+		{
+			return false;
+		}
+
+		std::istringstream fields(line.substr(commEnd + 1));
+		std::string skipped;
+		uint64_t childFaults = 0;
+		uint64_t userTicks = 0;
+		uint64_t systemTicks = 0;
+
+		// state, ppid, pgrp, session, tty_nr, tpgid, flags
+		for (int i = 0; i < 7; i++)
+		{
+			fields >> skipped;
+		}
+		fields >> stat.minorFaults >> childFaults >> stat.majorFaults >> childFaults >> userTicks >> systemTicks;
+		stat.cpuTicks = userTicks + systemTicks;
+		return !fields.fail();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void ProcMetricsProvider::readStatus(MetricsSample& sample)
+	{
+		std::ifstream statusFile("/proc/self/status");
+		std::string line;
+		while (std::getline(statusFile, line))
+		{
+			size_t separator = line.find(':');
+			if (separator == std::string::npos)
+			{
+				continue;
+			}
+
+			std::string_view key(line.data(), separator);
+			uint64_t value = std::strtoull(line.c_str() + separator + 1, nullptr, 10);
+			if (key == "VmRSS")
+			{
+				sample.memoryUsage = value / 1024.0f;
+			}
+			else if (key == "VmHWM")
+			{
+				sample.peakMemoryUsage = value / 1024.0f;
+			}
+			else if (key == "voluntary_ctxt_switches")
+			{
+				sample.voluntaryContextSwitches = value;
+			}
+			else if (key == "nonvoluntary_ctxt_switches")
+			{
+				sample.involuntaryContextSwitches = value;
+			}
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void ProcMetricsProvider::sampleThreads(MetricsSample& sample, float elapsedTicks)
+	{
+		std::unordered_map<int, uint64_t> threadTicks;
+		std::error_code error;
+		for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator("/proc/self/task", error))
+		{
+			std::string taskPath = entry.path().string();
+			ProcessStat threadStat;
+			if (!readProcessStat(taskPath + "/stat", threadStat))
+			{
+				// the thread has exited since the directory was listed
+				continue;
+			}
+
+			int threadId = std::atoi(entry.path().filename().c_str());
+			threadTicks[threadId] = threadStat.cpuTicks;
+
+			// threads that started after the previous sample are reported from the next one
+			auto lastTicks = m_lastThreadTicks.find(threadId);
+			if (lastTicks == m_lastThreadTicks.end() || elapsedTicks <= 0.0f)
+			{
+				continue;
+			}
+
+			ThreadCpuUsage usage;
+			usage.id = threadId;
+			usage.mainThread = threadId == m_mainThreadId;
+			usage.cpuUsage = 100.0f * (threadStat.cpuTicks - lastTicks->second) / elapsedTicks;
+			usage.cpuTime = threadStat.cpuTicks / m_ticksPerSecond;
+
+			std::ifstream commFile(taskPath + "/comm");
+			std::getline(commFile, usage.name);
+			// the name ends up as a key of the stats file
+			std::replace(usage.name.begin(), usage.name.end(), ':', '_');
+			sample.threads.push_back(std::move(usage));
+		}
+
+		m_lastThreadTicks = std::move(threadTicks);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+}
+
+#endif
\ No newline at end of file
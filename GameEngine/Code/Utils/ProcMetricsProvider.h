@@ -0,0 +1,54 @@
+#pragma once
+
+#ifdef __linux__
+
+#include <chrono>
+#include <unordered_map>
+
+#include "IMetricsProvider.h"
+
+namespace Engine::Utils
+{
+	// Reads the counters from procfs: /proc/stat for the whole system, /proc/self/stat and /proc/self/status
+	// for the process and /proc/self/task/<tid>/stat for every thread.
+	class ProcMetricsProvider: public IMetricsProvider
+	{
+	public:
+		bool open() override;
+		void close() override;
+		bool sample(MetricsSample& sample) override;
+
+	private:
+		using Clock = std::chrono::steady_clock;
+
+		struct SystemTicks
+		{
+			uint64_t busy = 0;
+			uint64_t total = 0;
+		};
+
+		struct ProcessStat
+		{
+			uint64_t minorFaults = 0;
+			uint64_t majorFaults = 0;
+			uint64_t cpuTicks = 0;
+		};
+
+		static bool readSystemTicks(SystemTicks& ticks);
+		static bool readProcessStat(const std::string& path, ProcessStat& stat);
+		static void readStatus(MetricsSample& sample);
+		void sampleThreads(MetricsSample& sample, float elapsedTicks);
+
+	private:
+		int m_mainThreadId = 0;
+		float m_ticksPerSecond = 100.0f;
+		unsigned int m_coresCount = 1;
+
+		Clock::time_point m_lastSampleTime;
+		SystemTicks m_lastSystemTicks;
+		uint64_t m_lastProcessTicks = 0;
+		std::unordered_map<int, uint64_t> m_lastThreadTicks;
+	};
+}
+
+#endif
\ No newline at end of file
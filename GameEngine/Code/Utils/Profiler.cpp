@@ -0,0 +1,161 @@
+#include "Profiler.h"
+
+#include <fstream>
+
+namespace Engine::Utils
+{
+	//////////////////////////////////////////////////////////////////////////
+
+	Profiler& Profiler::get()
+	{
+		static Profiler profiler;
+		return profiler;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	// the time stamp counter is several times cheaper to read than the system clock,
+	// it is converted to microseconds against the clock only when a capture is saved
+	Profiler::Profiler(): m_originTime(Clock::now()), m_originTicks(__rdtsc())
+	{
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void Profiler::setEnabled(bool enabled)
+	{
+		m_enabled.store(enabled, std::memory_order_relaxed);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	bool Profiler::isEnabled() const
+	{
+		return m_enabled.load(std::memory_order_relaxed);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void Profiler::beginZone(const char* name)
+	{
+		record(getThreadBuffer(), name);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void Profiler::endZone()
+	{
+		record(getThreadBuffer(), nullptr);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	Profiler::Snapshot Profiler::snapshot(Clock::time_point since) const
+	{
+		uint64_t sinceTicks = 0;
+		if (since > m_originTime)
+		{
+			std::chrono::duration<double, std::micro> sinceOrigin = since - m_originTime;
+			sinceTicks = m_originTicks + static_cast<uint64_t>(sinceOrigin.count() * getTicksPerMicrosecond());
+		}
+
+		Snapshot snapshot;
+		std::lock_guard<std::mutex> lock(m_buffersMutex);
+		for (const std::unique_ptr<ThreadBuffer>& buffer : m_buffers)
+		{
+			ThreadEvents& threadEvents = snapshot.emplace_back();
+			threadEvents.threadId = buffer->threadId;
+
+			uint64_t writeIndex = buffer->writeIndex.load(std::memory_order_acquire);
+			uint64_t readIndex = writeIndex > k_eventsPerThread ? writeIndex - k_eventsPerThread : 0;
+
+			// once the ring wraps the oldest end events lose their begin events
+			size_t depth = 0;
+			for (; readIndex < writeIndex; readIndex++)
+			{
+				const ZoneEvent& event = buffer->events[readIndex & k_mask];
+				if ((event.name == nullptr && depth == 0) || (event.name != nullptr && depth == 0 && event.timestamp < sinceTicks))
+				{
+					continue;
+				}
+				depth = event.name != nullptr ? depth + 1 : depth - 1;
+				threadEvents.events.push_back(event);
+			}
+		}
+		return snapshot;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	bool Profiler::saveChromeTrace(const std::string& path, Clock::time_point since) const
+	{
+		return saveChromeTrace(path, snapshot(since));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	bool Profiler::saveChromeTrace(const std::string& path, const Snapshot& snapshot) const
+	{
+		std::ofstream outFile(path);
+		if (!outFile.is_open())
+		{
+			return false;
+		}
+
+		double ticksPerMicrosecond = getTicksPerMicrosecond();
+		outFile << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+		bool firstEvent = true;
+
+		for (const ThreadEvents& threadEvents : snapshot)
+		{
+			for (const ZoneEvent& event : threadEvents.events)
+			{
+				double timestamp = (event.timestamp - m_originTicks) / ticksPerMicrosecond;
+				outFile << (firstEvent ? "" : ",") << "\n{\"ph\":\"" << (event.name != nullptr ? "B" : "E") << "\"";
+				if (event.name != nullptr)
+				{
+					outFile << ",\"name\":\"";
+					for (const char* c = event.name; *c != '\0'; c++)
+					{
+						if (*c == '"' || *c == '\\')
+						{
+							outFile << '\\';
+						}
+						outFile << *c;
+					}
+					outFile << "\"";
+				}
+				outFile << ",\"pid\":0,\"tid\":" << threadEvents.threadId << ",\"ts\":" << std::fixed << timestamp << "}";
+				firstEvent = false;
+			}
+		}
+
+		outFile << "\n]}";
+		return outFile.good();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	double Profiler::getTicksPerMicrosecond() const
+	{
+		uint64_t ticks = __rdtsc() - m_originTicks;
+		std::chrono::duration<double, std::micro> elapsed = Clock::now() - m_originTime;
+		return elapsed.count() > 0.0 ? ticks / elapsed.count() : 1.0;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	Profiler::ThreadBuffer& Profiler::createThreadBuffer()
+	{
+		auto buffer = std::make_unique<ThreadBuffer>();
+		buffer->events = std::make_unique<ZoneEvent[]>(k_eventsPerThread);
+		s_threadBuffer = buffer.get();
+
+		std::lock_guard<std::mutex> lock(m_buffersMutex);
+		buffer->threadId = static_cast<uint32_t>(m_buffers.size());
+		m_buffers.push_back(std::move(buffer));
+		return *s_threadBuffer;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+}
\ No newline at end of file
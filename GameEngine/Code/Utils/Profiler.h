@@ -0,0 +1,108 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Engine::Utils
+{
+	// Records nested begin/end zone timestamps into a ring per thread. Zones are only
+	// compiled in when _PROFILE is defined, and only recorded while the profiler is enabled.
+	class Profiler
+	{
+	public:
+		using Clock = std::chrono::steady_clock;
+
+		struct ZoneEvent
+		{
+			const char* name; // nullptr marks the end of the innermost zone
+			uint64_t timestamp;
+		};
+
+		struct ThreadEvents
+		{
+			uint32_t threadId;
+			std::vector<ZoneEvent> events;
+		};
+
+		// copied zones, so a trace can be written on another thread while the rings keep being written
+		using Snapshot = std::vector<ThreadEvents>;
+
+		static Profiler& get();
+
+		void setEnabled(bool enabled);
+		bool isEnabled() const;
+
+		void beginZone(const char* name);
+		void endZone();
+
+		// only zones that began at or after since are kept, the calling thread's own ring is copied consistently
+		Snapshot snapshot(Clock::time_point since = Clock::time_point::min()) const;
+		bool saveChromeTrace(const std::string& path, Clock::time_point since = Clock::time_point::min()) const;
+		bool saveChromeTrace(const std::string& path, const Snapshot& snapshot) const;
+
+	private:
+		struct ThreadBuffer
+		{
+			uint32_t threadId;
+			std::atomic<uint64_t> writeIndex = 0;
+			std::unique_ptr<ZoneEvent[]> events;
+		};
+
+	private:
+		Profiler();
+
+		static void record(ThreadBuffer& buffer, const char* name);
+		ThreadBuffer& getThreadBuffer();
+		ThreadBuffer& createThreadBuffer();
+		double getTicksPerMicrosecond() const;
+
+		friend class ProfileZone;
+
+	private:
+		static constexpr size_t k_eventsPerThread = 1 << 18;
+		static constexpr size_t k_mask = k_eventsPerThread - 1;
+
+		std::atomic<bool> m_enabled = false;
+		Clock::time_point m_originTime;
+		uint64_t m_originTicks;
+
+		mutable std::mutex m_buffersMutex;
+		std::vector<std::unique_ptr<ThreadBuffer>> m_buffers;
+
+		// buffers outlive their threads so a capture can be saved after a worker has finished
+		static inline thread_local ThreadBuffer* s_threadBuffer = nullptr;
+	};
+
+	class ProfileZone
+	{
+	public:
+		explicit ProfileZone(const char* name);
+		~ProfileZone();
+
+		ProfileZone(const ProfileZone&) = delete;
+		ProfileZone& operator=(const ProfileZone&) = delete;
+
+	private:
+		// the end event goes to the ring the zone began in, so the profiler is looked up only once
+		Profiler::ThreadBuffer* m_buffer;
+	};
+}
+
+#ifdef _PROFILE
+
+#define PROFILE_CONCAT_IMPL(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_IMPL(a, b)
+#define PROFILE_ZONE(name) const Engine::Utils::ProfileZone PROFILE_CONCAT(profileZone, __LINE__)(name)
+
+#else
+
+#define PROFILE_ZONE(name) do { } while (false)
+
+#endif
+
+#include "Profiler.inl"
\ No newline at end of file
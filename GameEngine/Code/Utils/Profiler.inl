@@ -0,0 +1,59 @@
+#pragma once
+
+#include "Profiler.h"
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+
+namespace Engine::Utils
+{
+	//////////////////////////////////////////////////////////////////////////
+
+	inline void Profiler::record(ThreadBuffer& buffer, const char* name)
+	{
+		uint64_t index = buffer.writeIndex.load(std::memory_order_relaxed);
+		buffer.events[index & k_mask] = { name, __rdtsc() };
+		buffer.writeIndex.store(index + 1, std::memory_order_release);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	inline Profiler::ThreadBuffer& Profiler::getThreadBuffer()
+	{
+		if (s_threadBuffer != nullptr)
+		{
+			return *s_threadBuffer;
+		}
+
+		return createThreadBuffer();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	inline ProfileZone::ProfileZone(const char* name)
+		: m_buffer(nullptr)
+	{
+		Profiler& profiler = Profiler::get();
+		if (profiler.isEnabled())
+		{
+			m_buffer = &profiler.getThreadBuffer();
+			Profiler::record(*m_buffer, name);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	inline ProfileZone::~ProfileZone()
+	{
+		// a zone that began before the profiler was enabled has no begin event to close
+		if (m_buffer != nullptr)
+		{
+			Profiler::record(*m_buffer, nullptr);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+}
\ No newline at end of file
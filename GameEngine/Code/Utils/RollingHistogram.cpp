@@ -0,0 +1,70 @@
+#include "RollingHistogram.h"
+
+#include <algorithm>
+
+namespace Engine::Utils
+{
+	//////////////////////////////////////////////////////////////////////////
+
+	RollingHistogram::RollingHistogram(size_t windowSize) : m_windowSize(std::max<size_t>(windowSize, 1))
+	{
+		m_window.reserve(m_windowSize);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void RollingHistogram::add(float value)
+	{
+		if (m_window.size() < m_windowSize)
+		{
+			m_window.push_back(value);
+		}
+		else
+		{
+			m_histogram.remove(m_window[m_nextSample]);
+			m_window[m_nextSample] = value;
+		}
+		m_nextSample = (m_nextSample + 1) % m_windowSize;
+		m_histogram.add(value);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void RollingHistogram::clear()
+	{
+		m_histogram.clear();
+		m_window.clear();
+		m_nextSample = 0;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	size_t RollingHistogram::getCount() const
+	{
+		return m_histogram.getCount();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	float RollingHistogram::getMean() const
+	{
+		return m_histogram.getMean();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	float RollingHistogram::getMax() const
+	{
+		// the histogram keeps the maximum of every sample it has seen, the window's has to be rescanned
+		return m_window.empty() ? 0.0f : *std::max_element(m_window.begin(), m_window.end());
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	float RollingHistogram::getPercentile(float percentile) const
+	{
+		return std::min(m_histogram.getPercentile(percentile), getMax());
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+}
\ No newline at end of file
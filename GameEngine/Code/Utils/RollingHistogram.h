@@ -0,0 +1,31 @@
+#pragma once
+
+#include <vector>
+#include <cstddef>
+
+#include "HdrHistogram.h"
+
+namespace Engine::Utils
+{
+	// Durations in seconds of the last windowSize samples, counted in an HdrHistogram that gives back
+	// each sample once it leaves the window. Unbounded series use HdrHistogram directly.
+	class RollingHistogram
+	{
+	public:
+		explicit RollingHistogram(size_t windowSize);
+
+		void add(float value);
+		void clear();
+
+		size_t getCount() const;
+		float getMean() const;
+		float getMax() const;
+		float getPercentile(float percentile) const;
+
+	private:
+		HdrHistogram m_histogram;
+		std::vector<float> m_window;
+		size_t m_windowSize;
+		size_t m_nextSample = 0;
+	};
+}
\ No newline at end of file
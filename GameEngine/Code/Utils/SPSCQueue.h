@@ -0,0 +1,34 @@
+#pragma once
+
+#include <atomic>
+#include <array>
+#include <cstddef>
+
+namespace Engine::Utils
+{
+	// Bounded single-producer single-consumer ring. push is only called from one thread
+	// and pop from one other thread; both are wait-free.
+	template <typename T, size_t Capacity>
+	class SPSCQueue
+	{
+		static_assert(Capacity > 1 && (Capacity & (Capacity - 1)) == 0, "SPSCQueue capacity must be a power of two");
+
+	public:
+		bool push(const T& value);
+		bool pop(T& value);
+		bool empty() const;
+		size_t size() const;
+
+	private:
+		static constexpr size_t k_cacheLineSize = 64;
+		static constexpr size_t k_mask = Capacity - 1;
+
+		alignas(k_cacheLineSize) std::atomic<size_t> m_head = 0;
+		size_t m_cachedTail = 0;
+		alignas(k_cacheLineSize) std::atomic<size_t> m_tail = 0;
+		size_t m_cachedHead = 0;
+		alignas(k_cacheLineSize) std::array<T, Capacity> m_buffer;
+	};
+}
+
+#include "SPSCQueue.inl"
\ No newline at end of file
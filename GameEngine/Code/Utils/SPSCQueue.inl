@@ -0,0 +1,64 @@
+#pragma once
+
+#include "SPSCQueue.h"
+
+namespace Engine::Utils
+{
+	//////////////////////////////////////////////////////////////////////////
+
+	template <typename T, size_t Capacity>
+	bool SPSCQueue<T, Capacity>::push(const T& value)
+	{
+		size_t tail = m_tail.load(std::memory_order_relaxed);
+		if (tail - m_cachedHead == Capacity)
+		{
+			m_cachedHead = m_head.load(std::memory_order_acquire);
+			if (tail - m_cachedHead == Capacity)
+			{
+				return false;
+			}
+		}
+
+		m_buffer[tail & k_mask] = value;
+		m_tail.store(tail + 1, std::memory_order_release);
+		return true;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	template <typename T, size_t Capacity>
+	bool SPSCQueue<T, Capacity>::pop(T& value)
+	{
+		size_t head = m_head.load(std::memory_order_relaxed);
+		if (head == m_cachedTail)
+		{
+			m_cachedTail = m_tail.load(std::memory_order_acquire);
+			if (head == m_cachedTail)
+			{
+				return false;
+			}
+		}
+
+		value = m_buffer[head & k_mask];
+		m_head.store(head + 1, std::memory_order_release);
+		return true;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	template <typename T, size_t Capacity>
+	bool SPSCQueue<T, Capacity>::empty() const
+	{
+		return size() == 0;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	template <typename T, size_t Capacity>
+	size_t SPSCQueue<T, Capacity>::size() const
+	{
+		return m_tail.load(std::memory_order_acquire) - m_head.load(std::memory_order_acquire);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+}
\ No newline at end of file
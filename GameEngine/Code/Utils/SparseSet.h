@@ -3,6 +3,7 @@
 #include <concepts>
 #include <vector>
 #include <iterator>
+#include <memory>
 
 namespace Engine::Utils
 {
@@ -10,11 +11,15 @@ namespace Engine::Utils
     class SparseSetBase
     {
     public:
+        virtual ~SparseSetBase() = default;
+
         const std::vector<IDType>& getIds() const;
         bool isPresent(IDType entity) const;
+        int getIndex(IDType entity) const;
         size_t size() const;
         virtual bool removeElement(IDType id);
         virtual void clear();
+        virtual std::unique_ptr<SparseSetBase> createEmpty() const = 0;
 
     protected:
         std::vector<int> m_sparse; // Maps entity ID to index in dense array
@@ -33,11 +38,13 @@ namespace Engine::Utils
 
         bool removeElement(IDType entity) override;
         void clear() override;
+        std::unique_ptr<SparseSetBase<IDType>> createEmpty() const override;
 
         const std::vector<ElemType>& getElements() const;
         std::vector<ElemType>& getElements();
 
         using SparseSetBase<IDType>::isPresent;
+        using SparseSetBase<IDType>::getIndex;
         using SparseSetBase<IDType>::getIds;
         using SparseSetBase<IDType>::size;
 
@@ -106,6 +106,14 @@ namespace Engine::Utils
 
     //////////////////////////////////////////////////////////////////////////
 
+    template<typename ElemType, typename IDType>
+    std::unique_ptr<SparseSetBase<IDType>> SparseSet<ElemType, IDType>::createEmpty() const
+    {
+        return std::make_unique<SparseSet<ElemType, IDType>>();
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+
     template <typename ElemType, typename IDType>
     const std::vector<ElemType>& SparseSet<ElemType, IDType>::getElements() const
     {
@@ -130,6 +138,14 @@ namespace Engine::Utils
 
     //////////////////////////////////////////////////////////////////////////
 
+    template <typename IDType>
+    int SparseSetBase<IDType>::getIndex(IDType entity) const
+    {
+        return isPresent(entity) ? m_sparse[entity] : -1;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+
     template <typename IDType>
     size_t SparseSetBase<IDType>::size() const
     {
@@ -0,0 +1,108 @@
+#include "StartupTimeline.h"
+
+namespace Engine::Utils
+{
+	//////////////////////////////////////////////////////////////////////////
+
+	void StartupTimeline::begin()
+	{
+		m_origin = Clock::now();
+		m_phases.clear();
+		m_timeToFirstFrame.reset();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void StartupTimeline::addPhase(const std::string& name, const std::string& category, Clock::time_point start)
+	{
+		// loads during the run are not part of startup and would grow the timeline without bound
+		if (hasFirstFrame())
+		{
+			return;
+		}
+
+		Clock::time_point end = Clock::now();
+		std::chrono::duration<float> startOffset = start - m_origin;
+		std::chrono::duration<float> duration = end - start;
+		m_phases.push_back({ name, category, startOffset.count(), duration.count() });
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void StartupTimeline::markFirstFrame()
+	{
+		if (m_timeToFirstFrame.has_value())
+		{
+			return;
+		}
+
+		std::chrono::duration<float> timeToFirstFrame = Clock::now() - m_origin;
+		m_timeToFirstFrame = timeToFirstFrame.count();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	bool StartupTimeline::hasFirstFrame() const
+	{
+		return m_timeToFirstFrame.has_value();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	float StartupTimeline::getTimeToFirstFrame() const
+	{
+		return m_timeToFirstFrame.value_or(0.0f);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	float StartupTimeline::getCategoryDuration(const std::string& category) const
+	{
+		float duration = 0.0f;
+		for (const Phase& phase : m_phases)
+		{
+			if (phase.category == category)
+			{
+				duration += phase.duration;
+			}
+		}
+		return duration;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	const std::vector<StartupTimeline::Phase>& StartupTimeline::getPhases() const
+	{
+		return m_phases;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	nlohmann::json StartupTimeline::toJson() const
+	{
+		nlohmann::json timelineJson;
+		timelineJson["timeToFirstFrame"] = getTimeToFirstFrame();
+
+		nlohmann::json& categoriesJson = timelineJson["categories"];
+		for (const char* category : { k_engineCategory, k_backendCategory, k_assetCategory })
+		{
+			categoriesJson[category] = getCategoryDuration(category);
+		}
+
+		nlohmann::json& phasesJson = timelineJson["phases"];
+		phasesJson = nlohmann::json::array();
+		for (const Phase& phase : m_phases)
+		{
+			phasesJson.push_back({
+				{ "name", phase.name },
+				{ "category", phase.category },
+				{ "start", phase.start },
+				{ "duration", phase.duration }
+			});
+		}
+
+		return timelineJson;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+}
\ No newline at end of file
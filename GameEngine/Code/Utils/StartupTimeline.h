@@ -0,0 +1,44 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <chrono>
+#include <optional>
+#include <nlohmann/json.hpp>
+
+namespace Engine::Utils
+{
+	class StartupTimeline
+	{
+	public:
+		using Clock = std::chrono::steady_clock;
+
+		struct Phase
+		{
+			std::string name;
+			std::string category;
+			float start;
+			float duration;
+		};
+
+		void begin();
+		void addPhase(const std::string& name, const std::string& category, Clock::time_point start);
+		void markFirstFrame();
+
+		bool hasFirstFrame() const;
+		float getTimeToFirstFrame() const;
+		float getCategoryDuration(const std::string& category) const;
+		const std::vector<Phase>& getPhases() const;
+		nlohmann::json toJson() const;
+
+	public:
+		static constexpr const char* k_engineCategory = "engine";
+		static constexpr const char* k_backendCategory = "backend";
+		static constexpr const char* k_assetCategory = "asset";
+
+	private:
+		Clock::time_point m_origin = Clock::now();
+		std::vector<Phase> m_phases;
+		std::optional<float> m_timeToFirstFrame;
+	};
+}
\ No newline at end of file
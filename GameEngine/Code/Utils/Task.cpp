@@ -0,0 +1,209 @@
+#include "Task.h"
+
+#include <new>
+#include <exception>
+
+#include "Managers/TasksManager.h"
+
+namespace Engine::Utils
+{
+	//////////////////////////////////////////////////////////////////////////
+
+	thread_local TaskFrameAllocator::FreeBlock* TaskFrameAllocator::m_freeLists[k_sizeClassesCount] = {};
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void* TaskFrameAllocator::allocate(size_t size)
+	{
+		size_t sizeClass = getSizeClass(size);
+		if (sizeClass >= k_sizeClassesCount)
+		{
+			return ::operator new(size);
+		}
+
+		FreeBlock* block = m_freeLists[sizeClass];
+		if (block != nullptr)
+		{
+			m_freeLists[sizeClass] = block->next;
+			return block;
+		}
+
+		return ::operator new(k_minBlockSize << sizeClass);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void TaskFrameAllocator::deallocate(void* ptr, size_t size)
+	{
+		size_t sizeClass = getSizeClass(size);
+		if (sizeClass >= k_sizeClassesCount)
+		{
+			::operator delete(ptr);
+			return;
+		}
+
+		FreeBlock* block = static_cast<FreeBlock*>(ptr);
+		block->next = m_freeLists[sizeClass];
+		m_freeLists[sizeClass] = block;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	size_t TaskFrameAllocator::getSizeClass(size_t size)
+	{
+		size_t sizeClass = 0;
+		size_t blockSize = k_minBlockSize;
+		while (blockSize < size)
+		{
+			blockSize <<= 1;
+			sizeClass++;
+		}
+		return sizeClass;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	Task Task::promise_type::get_return_object()
+	{
+		return Task(Handle::from_promise(*this));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	std::suspend_always Task::promise_type::initial_suspend() noexcept
+	{
+		return {};
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	Task::FinalAwaiter Task::promise_type::final_suspend() noexcept
+	{
+		return {};
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void Task::promise_type::return_void()
+	{
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void Task::promise_type::unhandled_exception()
+	{
+		std::terminate();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void* Task::promise_type::operator new(size_t size)
+	{
+		return TaskFrameAllocator::allocate(size);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void Task::promise_type::operator delete(void* ptr, size_t size)
+	{
+		TaskFrameAllocator::deallocate(ptr, size);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	bool Task::FinalAwaiter::await_ready() const noexcept
+	{
+		return false;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	std::coroutine_handle<> Task::FinalAwaiter::await_suspend(std::coroutine_handle<promise_type> handle) noexcept
+	{
+		promise_type& promise = handle.promise();
+		if (promise.continuation)
+		{
+			return promise.continuation;
+		}
+
+		if (promise.manager)
+		{
+			promise.manager->onTaskFinished(handle);
+		}
+		return std::noop_coroutine();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void Task::FinalAwaiter::await_resume() const noexcept
+	{
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	Task::Task(Handle handle) : m_handle(handle)
+	{
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	Task::Task(Task&& other) noexcept : m_handle(std::exchange(other.m_handle, nullptr))
+	{
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	Task& Task::operator=(Task&& other) noexcept
+	{
+		if (this != &other)
+		{
+			if (m_handle)
+			{
+				m_handle.destroy();
+			}
+			m_handle = std::exchange(other.m_handle, nullptr);
+		}
+		return *this;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	Task::~Task()
+	{
+		if (m_handle)
+		{
+			m_handle.destroy();
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	bool Task::await_ready() const noexcept
+	{
+		return !m_handle || m_handle.done();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	std::coroutine_handle<> Task::await_suspend(std::coroutine_handle<> awaiting) noexcept
+	{
+		// a nested task runs right away and resumes its parent when it finishes
+		m_handle.promise().continuation = awaiting;
+		return m_handle;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void Task::await_resume() const noexcept
+	{
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	Task::Handle Task::release()
+	{
+		return std::exchange(m_handle, nullptr);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+}
\ No newline at end of file
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <coroutine>
+#include <cstddef>
+#include <utility>
+
+namespace Engine
+{
+	class TasksManager;
+}
+
+namespace Engine::Utils
+{
+	class TaskFrameAllocator
+	{
+	public:
+		static void* allocate(size_t size);
+		static void deallocate(void* ptr, size_t size);
+
+	private:
+		struct FreeBlock
+		{
+			FreeBlock* next;
+		};
+
+		static size_t getSizeClass(size_t size);
+
+	private:
+		static constexpr size_t k_minBlockSize = 64;
+		static constexpr size_t k_sizeClassesCount = 7;
+
+		static thread_local FreeBlock* m_freeLists[k_sizeClassesCount];
+	};
+
+	class Task
+	{
+	public:
+		struct promise_type;
+
+		struct FinalAwaiter
+		{
+			bool await_ready() const noexcept;
+			std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> handle) noexcept;
+			void await_resume() const noexcept;
+		};
+
+		struct promise_type
+		{
+			Task get_return_object();
+			std::suspend_always initial_suspend() noexcept;
+			FinalAwaiter final_suspend() noexcept;
+			void return_void();
+			void unhandled_exception();
+
+			static void* operator new(size_t size);
+			static void operator delete(void* ptr, size_t size);
+
+			std::coroutine_handle<> continuation = nullptr;
+			TasksManager* manager = nullptr;
+		};
+
+		using Handle = std::coroutine_handle<promise_type>;
+
+		Task() = default;
+		explicit Task(Handle handle);
+		Task(Task&& other) noexcept;
+		Task& operator=(Task&& other) noexcept;
+		Task(const Task&) = delete;
+		Task& operator=(const Task&) = delete;
+		~Task();
+
+		bool await_ready() const noexcept;
+		std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept;
+		void await_resume() const noexcept;
+
+		Handle release();
+
+	private:
+		Handle m_handle = nullptr;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,218 @@
+#include "TelemetryRing.h"
+
+#include <cstring>
+#include <new>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Engine::Utils
+{
+	//////////////////////////////////////////////////////////////////////////
+
+	TelemetryRing& TelemetryRing::get()
+	{
+		static TelemetryRing ring;
+		return ring;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	bool TelemetryRing::open(const std::string& name)
+	{
+		if (isOpen())
+		{
+			return true;
+		}
+
+		size_t size = k_headerSize + k_recordSize * k_recordsCount;
+		void* memory = nullptr;
+		bool existing = false;
+
+#ifdef _WIN32
+		std::string mappingName = "Local\\" + name;
+		HANDLE mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, 0, (DWORD)size, mappingName.c_str());
+		if (mapping == nullptr)
+		{
+			return false;
+		}
+		existing = GetLastError() == ERROR_ALREADY_EXISTS;
+
+		memory = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, size);
+		// an existing mapping keeps the size it was created with, a view larger than it fails
+		MEMORY_BASIC_INFORMATION memoryInfo{};
+		if (memory != nullptr && (VirtualQuery(memory, &memoryInfo, sizeof(memoryInfo)) == 0 || memoryInfo.RegionSize < size))
+		{
+			UnmapViewOfFile(memory);
+			memory = nullptr;
+		}
+		if (memory == nullptr)
+		{
+			CloseHandle(mapping);
+			return false;
+		}
+		m_mapping = mapping;
+#else
+		std::string mappingName = "/" + name;
+		int fd = shm_open(mappingName.c_str(), O_CREAT | O_RDWR, 0644);
+		if (fd == -1)
+		{
+			return false;
+		}
+
+		struct stat fileStat{};
+		if (fstat(fd, &fileStat) != 0)
+		{
+			::close(fd);
+			return false;
+		}
+		existing = fileStat.st_size != 0;
+
+		// a new object is empty, an existing one must already have the ring's size
+		if ((existing && (size_t)fileStat.st_size < size) || (!existing && ftruncate(fd, (off_t)size) != 0))
+		{
+			::close(fd);
+			return false;
+		}
+
+		memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+		::close(fd);
+		if (memory == MAP_FAILED)
+		{
+			return false;
+		}
+#endif
+
+		m_records = static_cast<uint8_t*>(memory) + k_headerSize;
+		m_startTime = Clock::now();
+		m_name = name;
+
+		// the mapping outlives this process while a reader holds it, records are then appended to it
+		// so that readers keep their position instead of seeing the ring reset
+		Header* header = static_cast<Header*>(memory);
+		if (existing && header->magic == k_magic)
+		{
+			std::atomic_thread_fence(std::memory_order_acquire);
+			if (header->version != k_version || header->recordSize != k_recordSize || header->recordsCount != k_recordsCount)
+			{
+				// the ring belongs to another build, it is left untouched
+#ifdef _WIN32
+				UnmapViewOfFile(memory);
+				CloseHandle(m_mapping);
+				m_mapping = nullptr;
+#else
+				munmap(memory, size);
+#endif
+				m_records = nullptr;
+				return false;
+			}
+
+			// timestamps continue from the start time of the run that created the ring
+			auto sinceStart = std::chrono::system_clock::now().time_since_epoch() - std::chrono::nanoseconds(header->startTime);
+			m_startTime -= std::chrono::duration_cast<Clock::duration>(sinceStart);
+			m_header = header;
+			return true;
+		}
+
+		std::memset(memory, 0, size);
+		m_header = new (memory) Header{};
+		m_header->version = k_version;
+		m_header->recordSize = k_recordSize;
+		m_header->recordsCount = k_recordsCount;
+		m_header->startTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+		m_header->writeIndex.store(0, std::memory_order_relaxed);
+
+		// the magic is written last so that a reader never accepts a half initialized header
+		std::atomic_thread_fence(std::memory_order_release);
+		m_header->magic = k_magic;
+		return true;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void TelemetryRing::close()
+	{
+		if (!isOpen())
+		{
+			return;
+		}
+
+#ifdef _WIN32
+		UnmapViewOfFile(m_header);
+		CloseHandle(m_mapping);
+#else
+		munmap(m_header, k_headerSize + k_recordSize * k_recordsCount);
+		shm_unlink(("/" + m_name).c_str());
+#endif
+
+		m_header = nullptr;
+		m_records = nullptr;
+		m_mapping = nullptr;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	bool TelemetryRing::isOpen() const
+	{
+		return m_header != nullptr;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void TelemetryRing::publishFrame(const FramePayload& payload)
+	{
+		publish(RecordType::Frame, &payload, sizeof(payload));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void TelemetryRing::publishStats(const StatsPayload& payload)
+	{
+		publish(RecordType::Stats, &payload, sizeof(payload));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void TelemetryRing::publishSystem(const SystemPayload& payload)
+	{
+		publish(RecordType::System, &payload, sizeof(payload));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	TelemetryRing::~TelemetryRing()
+	{
+		close();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	void TelemetryRing::publish(RecordType type, const void* payload, size_t size)
+	{
+		if (!isOpen())
+		{
+			return;
+		}
+
+		uint64_t index = m_header->writeIndex.fetch_add(1, std::memory_order_relaxed);
+		uint8_t* record = m_records + (index % k_recordsCount) * k_recordSize;
+		RecordHeader* recordHeader = reinterpret_cast<RecordHeader*>(record);
+
+		recordHeader->sequence.store(0, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+
+		recordHeader->type = type;
+		recordHeader->timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - m_startTime).count();
+		std::memcpy(record + sizeof(RecordHeader), payload, size);
+
+		recordHeader->sequence.store(index + 1, std::memory_order_release);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+}
\ No newline at end of file
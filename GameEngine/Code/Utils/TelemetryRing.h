@@ -0,0 +1,130 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace Engine::Utils
+{
+	// Publishes frame timings and stats into a named shared-memory ring so that external tools
+	// can watch a run live. Writers never block: a record index is claimed with a single atomic
+	// increment and the record is then filled in place, older records are overwritten.
+	//
+	// Layout, little-endian, all fields naturally aligned:
+	//   Header, k_headerSize bytes:
+	//     uint32 magic (k_magic), uint32 version, uint32 recordSize, uint32 recordsCount,
+	//     uint64 writeIndex (index of the next record to be claimed), uint64 startTime (ns)
+	//   Records, recordsCount times recordSize bytes, record i is stored in slot i % recordsCount:
+	//     uint64 sequence (i + 1 once record i is complete, 0 while it is being written),
+	//     uint32 type (RecordType), uint32 reserved, uint64 timestamp (ns since startTime),
+	//     payload (FramePayload, StatsPayload or SystemPayload)
+	// A reader copies a record and accepts it only if sequence read before and after the copy equals i + 1.
+	// A ring that still exists when the engine starts, because a reader holds it, is appended to rather than reset.
+	class TelemetryRing
+	{
+	public:
+		using Clock = std::chrono::steady_clock;
+
+		static constexpr uint32_t k_magic = 0x314D4C54; // "TLM1"
+		static constexpr uint32_t k_version = 1;
+		static constexpr size_t k_headerSize = 64;
+		static constexpr size_t k_recordSize = 128;
+		static constexpr size_t k_recordsCount = 1 << 14;
+		static constexpr size_t k_systemNameSize = 48;
+		static constexpr const char* k_defaultName = "GameEngineTelemetry";
+
+		enum class RecordType: uint32_t
+		{
+			Frame = 1,
+			Stats = 2,
+			System = 3
+		};
+
+		struct FramePayload
+		{
+			uint64_t frameIndex;
+			float frameTime;
+			float pacingError;
+			uint64_t allocations;
+			uint64_t drawCalls;
+			uint64_t triangles;
+		};
+
+		struct StatsPayload
+		{
+			float avgFPS;
+			float avgFrameTime;
+			float memoryUsage;
+			float gpuMemoryUsage;
+			float cpuUsage;
+			float gpuUsage;
+			float frameTimePercentile99;
+			float pacingErrorMedian;
+			float pacingErrorPercentile99;
+			float allocationsPerFrame;
+		};
+
+		struct SystemPayload
+		{
+			char name[k_systemNameSize];
+			float budget;
+			float meanTime;
+			float percentile99Time;
+			float maxTime;
+			uint64_t budgetOverruns;
+			uint64_t updatesCount;
+		};
+
+		static TelemetryRing& get();
+
+		bool open(const std::string& name = k_defaultName);
+		void close();
+		bool isOpen() const;
+
+		void publishFrame(const FramePayload& payload);
+		void publishStats(const StatsPayload& payload);
+		void publishSystem(const SystemPayload& payload);
+
+		~TelemetryRing();
+
+	private:
+		struct Header
+		{
+			uint32_t magic;
+			uint32_t version;
+			uint32_t recordSize;
+			uint32_t recordsCount;
+			std::atomic<uint64_t> writeIndex;
+			uint64_t startTime;
+		};
+
+		struct RecordHeader
+		{
+			std::atomic<uint64_t> sequence;
+			RecordType type;
+			uint32_t reserved;
+			uint64_t timestamp;
+		};
+
+		static constexpr size_t k_payloadSize = k_recordSize - sizeof(RecordHeader);
+
+		static_assert(std::atomic<uint64_t>::is_always_lock_free, "the ring is shared with other processes");
+		static_assert(sizeof(Header) <= k_headerSize);
+		static_assert(sizeof(FramePayload) <= k_payloadSize);
+		static_assert(sizeof(StatsPayload) <= k_payloadSize);
+		static_assert(sizeof(SystemPayload) <= k_payloadSize);
+
+	private:
+		TelemetryRing() = default;
+
+		void publish(RecordType type, const void* payload, size_t size);
+
+	private:
+		Header* m_header = nullptr;
+		uint8_t* m_records = nullptr;
+		Clock::time_point m_startTime;
+		std::string m_name;
+		void* m_mapping = nullptr;
+	};
+}
\ No newline at end of file
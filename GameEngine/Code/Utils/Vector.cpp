@@ -156,6 +156,32 @@ namespace Engine::Utils
 
 	//////////////////////////////////////////////////////////////////////////
 
+	Vector3 Vector3::lerp(const Vector3& from, const Vector3& to, float t)
+	{
+		return Vector3(
+			from.x + (to.x - from.x) * t,
+			from.y + (to.y - from.y) * t,
+			from.z + (to.z - from.z) * t);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
+	Vector3 Vector3::lerpAngles(const Vector3& from, const Vector3& to, float t)
+	{
+		// remainder maps the difference into [-pi, pi]
+		auto shortestDelta = [](float from, float to)
+			{
+				return std::remainder(to - from, 2.0f * 3.14159265358979f);
+			};
+
+		return Vector3(
+			from.x + shortestDelta(from.x, to.x) * t,
+			from.y + shortestDelta(from.y, to.y) * t,
+			from.z + shortestDelta(from.z, to.z) * t);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+
 	float Vector3::angleBetweenVectors(const Vector3& otherVector) const
 	{
 		return std::acos(dotProduct(*this, otherVector) / std::sqrtf(lengthSqr() * otherVector.lengthSqr())
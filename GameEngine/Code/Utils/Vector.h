@@ -35,6 +35,9 @@ namespace Engine::Utils
 		float lengthSqr() const;
 		static float dotProduct(const Vector3& left, const Vector3& right);
 		static Vector3 crossProduct(const Vector3& left, const Vector3& right);
+		static Vector3 lerp(const Vector3& from, const Vector3& to, float t);
+		// blends Euler angles in radians along the shorter way around the circle
+		static Vector3 lerpAngles(const Vector3& from, const Vector3& to, float t);
 
 		float angleBetweenVectors(const Vector3& otherVector) const;
 		void rotateArroundVector(const Vector3& v, float rotation);
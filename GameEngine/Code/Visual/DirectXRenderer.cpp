@@ -56,9 +56,12 @@ namespace Engine::Visual
 		m_constantBufferData.worldMatrix = XMMatrixTranspose(worldMatrix);
 
 		m_deviceContext->UpdateSubresource(m_constantBuffer.Get(), 0, nullptr, &m_constantBufferData, 0, 0);
+		m_frameStats.uniformUpdates++;
+		m_frameStats.uploadedBytes += sizeof(ConstantBuffer);
 
 		m_deviceContext->VSSetConstantBuffers(0, 1, m_constantBuffer.GetAddressOf());
 		m_deviceContext->PSSetConstantBuffers(0, 1, m_constantBuffer.GetAddressOf());
+		m_frameStats.resourceBinds += 2;
 
 		for (Material& material : modelData.materials)
 		{
@@ -69,14 +72,19 @@ namespace Engine::Visual
 			mb.shininess = material.shininess;
 			mb.useDiffuseTexture = material.useDiffuseTexture;
 			m_deviceContext->UpdateSubresource(material.materialBuffer.Get(), 0, nullptr, &mb, 0, 0);
+			m_frameStats.uniformUpdates++;
+			m_frameStats.uploadedBytes += sizeof(MaterialBuffer);
 		}
 
 		UINT stride = sizeof(Vertex);
 		UINT offset = 0;
 		m_deviceContext->IASetVertexBuffers(0, 1, modelData.vertexBuffer.GetAddressOf(), &stride, &offset);
 		m_deviceContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+		m_frameStats.bufferBinds++;
+		m_frameStats.vertices += modelData.vertices.size();
 
 		m_deviceContext->PSSetSamplers(0, 1, m_samplerState.GetAddressOf());
+		m_frameStats.resourceBinds++;
 
 		std::unordered_map<int, std::vector<size_t>> materialMeshes;
 		for (size_t i = 0; i < modelData.meshes.size(); i++)
@@ -89,11 +97,14 @@ namespace Engine::Visual
 			const Material& material = materialId != -1 ? modelData.materials[materialId] : m_defaultMaterial;
 			m_deviceContext->PSSetConstantBuffers(1, 1, material.materialBuffer.GetAddressOf());
 			m_deviceContext->PSSetShaderResources(0, 1, getTexture(material.useDiffuseTexture ? material.diffuseTextureId: m_defaultMaterial.diffuseTextureId).GetAddressOf());
+			m_frameStats.resourceBinds += 2;
 			for (size_t meshIndex : meshIndices)
 			{
 				const SubMesh& mesh = modelData.meshes[meshIndex];
 				m_deviceContext->IASetIndexBuffer(mesh.indexBuffer.Get(), DXGI_FORMAT_R32_UINT, 0);
 				m_deviceContext->DrawIndexed(mesh.indices.size(), 0, 0);
+				m_frameStats.bufferBinds++;
+				m_frameStats.addDrawCall(mesh.indices.size());
 			}
 		}
 
@@ -118,6 +129,16 @@ namespace Engine::Visual
 	void DirectXRenderer::render()
 	{
 		m_swapChain->Present(0, 0);
+
+		m_lastFrameStats = m_frameStats;
+		m_frameStats = {};
+	}
+
+	////////////////////////////////////////////////////////////////////////
+
+	RendererFrameStats DirectXRenderer::getFrameStats() const
+	{
+		return m_lastFrameStats;
 	}
 
 	////////////////////////////////////////////////////////////////////////
@@ -272,6 +293,7 @@ namespace Engine::Visual
 		{
 			return false;
 		}
+		m_frameStats.uploadedBytes += vertexBufferDesc.ByteWidth;
 
 		for (Material& material : model.materials)
 		{
@@ -301,6 +323,7 @@ namespace Engine::Visual
 			{
 				return false;
 			}
+			m_frameStats.uploadedBytes += indexBufferDesc.ByteWidth;
 		}
 
 		return true;
@@ -330,7 +353,7 @@ namespace Engine::Visual
 
 	////////////////////////////////////////////////////////////////////////
 
-	bool DirectXRenderer::loadModel(const std::string& filename)
+	bool DirectXRenderer::loadModel(const std::string& filename, const ModelFile& modelFile)
 	{
 		if (m_models.contains(filename))
 		{
@@ -338,7 +361,7 @@ namespace Engine::Visual
 		}
 
 		ModelData modelData;
-		if (!loadModelFromFile(modelData, filename))
+		if (!createModelData(modelData, modelFile))
 		{
 			return false;
 		}
@@ -382,27 +405,28 @@ namespace Engine::Visual
 			return false;
 		}
 
+		ComPtr<ID3D11Resource> textureResource;
+		ComPtr<ID3D11Texture2D> texture2D;
+		texture->GetResource(textureResource.GetAddressOf());
+		if (SUCCEEDED(textureResource.As(&texture2D)))
+		{
+			D3D11_TEXTURE2D_DESC textureDesc;
+			texture2D->GetDesc(&textureDesc);
+			m_frameStats.uploadedBytes += static_cast<uint64_t>(textureDesc.Width) * textureDesc.Height * 4;
+		}
+
 		m_textures.emplace(filename, std::move(texture));
 		return true;
 	}
 
 	////////////////////////////////////////////////////////////////////////
 
-	bool DirectXRenderer::loadModelFromFile(ModelData& model, const std::string& filename)
+	bool DirectXRenderer::createModelData(ModelData& model, const ModelFile& modelFile)
 	{
-		tinyobj::attrib_t attrib;
-		std::vector<tinyobj::shape_t> shapes;
-		std::vector<tinyobj::material_t> materials;
-		std::string warn, err;
-
-		std::filesystem::path fullPath(filename);
-		std::filesystem::path matDir = fullPath.parent_path();
-		bool res = tinyobj::LoadObj(&attrib, &shapes, &materials, &warn, &err, filename.c_str(), matDir.string().c_str());
-		ASSERT(res, "Can't load model: {}", filename);
-		if (!res) 
-		{
-			return false;
-		}
+		const tinyobj::attrib_t& attrib = modelFile.attrib;
+		const std::vector<tinyobj::shape_t>& shapes = modelFile.shapes;
+		const std::vector<tinyobj::material_t>& materials = modelFile.materials;
+		const std::filesystem::path& matDir = modelFile.materialDirectory;
 
 		for (const tinyobj::material_t& mat : materials)
 		{
@@ -34,7 +34,7 @@ namespace Engine::Visual
         void postRenderUI() override;
         void render() override;
 
-        bool loadModel(const std::string& filename) override;
+        bool loadModel(const std::string& filename, const ModelFile& modelFile) override;
         bool loadTexture(const std::string& filename) override;
 
         void setCameraProperties(const Utils::Vector3& position, const Utils::Vector3& rotation) override;
@@ -45,6 +45,7 @@ namespace Engine::Visual
         bool unloadTexture(const std::string& filename) override;
         bool unloadModel(const std::string& filename) override;
         void cleanUp() override;
+        RendererFrameStats getFrameStats() const override;
 
 
 
@@ -119,7 +120,7 @@ namespace Engine::Visual
         void initUI();
         void cleanUpUI();
         bool createBuffersForModel(ModelData& model);
-        bool loadModelFromFile(ModelData& model, const std::string& filename);
+        bool createModelData(ModelData& model, const ModelFile& modelFile);
 
         const ComPtr<ID3D11ShaderResourceView>& getTexture(const std::string& textureId) const;
 
@@ -145,6 +146,9 @@ namespace Engine::Visual
 
         std::unordered_map<std::string, ModelData> m_models;
         std::unordered_map<std::string, ComPtr<ID3D11ShaderResourceView>> m_textures;
+
+        RendererFrameStats m_frameStats;
+        RendererFrameStats m_lastFrameStats;
         
     };
 
@@ -5,6 +5,8 @@
 #include "Window.h"
 #include "Utils/Vector.h"
 #include "ModelInstanceBase.h"
+#include "ModelFile.h"
+#include "RendererFrameStats.h"
 
 namespace Engine::Visual
 {
@@ -25,7 +27,8 @@ namespace Engine::Visual
         virtual void render() = 0;
         virtual void preRenderUI() = 0;
         virtual void postRenderUI() = 0;
-        virtual bool loadModel(const std::string& filename) = 0;
+        // uploads a model parsed with ModelFile::parse, filename is the key it is drawn and unloaded by
+        virtual bool loadModel(const std::string& filename, const ModelFile& modelFile) = 0;
         virtual bool loadTexture(const std::string& filename) = 0;
 
         virtual std::unique_ptr<IModelInstance> createModelInstance(const std::string& filename) = 0;
@@ -36,6 +39,8 @@ namespace Engine::Visual
 
         virtual void cleanUp() = 0;
 
+        // counters of the last presented frame
+        virtual RendererFrameStats getFrameStats() const = 0;
 
         virtual ~IRenderer() = default;
 
@@ -0,0 +1,25 @@
+#include "ModelFile.h"
+
+namespace Engine::Visual
+{
+    ////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<const ModelFile> ModelFile::parse(const std::string& filename)
+    {
+        std::shared_ptr<ModelFile> modelFile = std::make_shared<ModelFile>();
+        modelFile->materialDirectory = std::filesystem::path(filename).parent_path();
+
+        std::string warn, err;
+        bool success = tinyobj::LoadObj(
+            &modelFile->attrib, &modelFile->shapes, &modelFile->materials, &warn, &err,
+            filename.c_str(), modelFile->materialDirectory.string().c_str());
+        if (!success)
+        {
+            return nullptr;
+        }
+
+        return modelFile;
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+}
\ No newline at end of file
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <filesystem>
+
+#include "tiny_obj_loader.h"
+
+namespace Engine::Visual
+{
+    // Parsed contents of an OBJ file. Parsing touches no renderer state, so it can run on any thread
+    // and the same data can be uploaded to every backend.
+    struct ModelFile
+    {
+        tinyobj::attrib_t attrib;
+        std::vector<tinyobj::shape_t> shapes;
+        std::vector<tinyobj::material_t> materials;
+        std::filesystem::path materialDirectory;
+
+        static std::shared_ptr<const ModelFile> parse(const std::string& filename);
+    };
+}
\ No newline at end of file
@@ -0,0 +1,172 @@
+#include "NullRenderer.h"
+
+#include <filesystem>
+
+#include "stb_image.h"
+#include "ModelInstanceBase.h"
+
+namespace Engine::Visual
+{
+    ////////////////////////////////////////////////////////////////////////
+
+    void NullRenderer::init(const Window& window)
+    {
+        m_frameStats = {};
+        m_lastFrameStats = {};
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+
+    void NullRenderer::clearBackground(float r, float g, float b, float a)
+    {
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+
+    void NullRenderer::draw(
+        const IModelInstance& model,
+        const Utils::Vector3& position,
+        const Utils::Vector3& rotation,
+        const Utils::Vector3& scale)
+    {
+        const auto& itr = m_models.find(model.GetId());
+        if (itr == m_models.end())
+        {
+            return;
+        }
+
+        // nothing is bound or uploaded, only the submitted geometry is counted
+        m_frameStats.vertices += itr->second.verticesCount;
+        for (size_t indicesCount : itr->second.meshIndicesCounts)
+        {
+            m_frameStats.addDrawCall(indicesCount);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+
+    void NullRenderer::preRenderUI()
+    {
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+
+    void NullRenderer::postRenderUI()
+    {
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+
+    void NullRenderer::render()
+    {
+        m_lastFrameStats = m_frameStats;
+        m_frameStats = {};
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+
+    bool NullRenderer::loadModel(const std::string& filename, const ModelFile& modelFile)
+    {
+        if (m_models.contains(filename))
+        {
+            return true;
+        }
+
+        for (const auto& mat : modelFile.materials)
+        {
+            if (!mat.diffuse_texname.empty())
+            {
+                loadTexture((modelFile.materialDirectory / mat.diffuse_texname).string());
+            }
+        }
+
+        ModelData modelData = { modelFile.attrib.vertices.size() / 3 };
+        for (const auto& shape : modelFile.shapes)
+        {
+            modelData.meshIndicesCounts.push_back(shape.mesh.indices.size());
+        }
+
+        m_models.emplace(filename, std::move(modelData));
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+
+    bool NullRenderer::loadTexture(const std::string& filename)
+    {
+        if (m_textures.contains(filename))
+        {
+            return true;
+        }
+
+        int width, height, channels;
+        unsigned char* data = stbi_load(filename.c_str(), &width, &height, &channels, STBI_rgb_alpha);
+        if (!data)
+        {
+            return false;
+        }
+        stbi_image_free(data);
+
+        m_textures.emplace(filename, static_cast<size_t>(width) * height * 4);
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+
+    void NullRenderer::setCameraProperties(const Utils::Vector3& position, const Utils::Vector3& rotation)
+    {
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+
+    void NullRenderer::setLightProperties(const Utils::Vector3& direction, float intensity)
+    {
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<IModelInstance> NullRenderer::createModelInstance(const std::string& filename)
+    {
+        return std::make_unique<ModelInstanceBase>(filename);
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+
+    bool NullRenderer::destroyModelInstance(IModelInstance& modelInstance)
+    {
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+
+    bool NullRenderer::unloadTexture(const std::string& filename)
+    {
+        m_textures.erase(filename);
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+
+    bool NullRenderer::unloadModel(const std::string& filename)
+    {
+        m_models.erase(filename);
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+
+    void NullRenderer::cleanUp()
+    {
+        m_models.clear();
+        m_textures.clear();
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+
+    RendererFrameStats NullRenderer::getFrameStats() const
+    {
+        return m_lastFrameStats;
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+}
\ No newline at end of file
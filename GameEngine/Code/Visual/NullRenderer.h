@@ -0,0 +1,56 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "IRenderer.h"
+
+namespace Engine::Visual
+{
+    // Performs the CPU side of asset loading and drawing without a graphics device,
+    // so the engine can be benchmarked without a window.
+    class NullRenderer : public IRenderer
+    {
+    public:
+
+        void init(const Window& window) override;
+        void clearBackground(float r, float g, float b, float a) override;
+
+        void draw(
+            const IModelInstance& model,
+            const Utils::Vector3& position,
+            const Utils::Vector3& rotation,
+            const Utils::Vector3& scale) override;
+
+        void preRenderUI() override;
+        void postRenderUI() override;
+        void render() override;
+
+        bool loadModel(const std::string& filename, const ModelFile& modelFile) override;
+        bool loadTexture(const std::string& filename) override;
+
+        void setCameraProperties(const Utils::Vector3& position, const Utils::Vector3& rotation) override;
+        void setLightProperties(const Utils::Vector3& direction, float intensity) override;
+        std::unique_ptr<IModelInstance> createModelInstance(const std::string& filename) override;
+
+        bool destroyModelInstance(IModelInstance& modelInstance) override;
+        bool unloadTexture(const std::string& filename) override;
+        bool unloadModel(const std::string& filename) override;
+        void cleanUp() override;
+        RendererFrameStats getFrameStats() const override;
+
+    private:
+        struct ModelData
+        {
+            size_t verticesCount;
+            std::vector<size_t> meshIndicesCounts;
+        };
+
+    private:
+        std::unordered_map<std::string, ModelData> m_models;
+        std::unordered_map<std::string, size_t> m_textures;
+        RendererFrameStats m_frameStats;
+        RendererFrameStats m_lastFrameStats;
+    };
+}
\ No newline at end of file
@@ -47,6 +47,7 @@ namespace Engine::Visual
         setPixelFormat();
         createWglContext();
         setInitialOpenGLState();
+        createTimerQueries();
         createShaderProgram("VertexShader.glsl", "FragmentShader.glsl");
         createShaderFields();
         createFrameBuffer();
@@ -61,12 +62,17 @@ namespace Engine::Visual
 
     void OpenGLRenderer::clearBackground(float r, float g, float b, float a)
     {
+        readTimerQueries();
+        writeTimerQuery(0);
+        m_uiTimerQueryWritten = false;
+
         glClearColor(r, g, b, a);
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
         // Use the shader program
         glUseProgram(m_shaderProgram);
         ASSERT_OPENGL("Unable to use shader program");
+        m_frameStats.pipelineBinds++;
     }
 
     ////////////////////////////////////////////////////////////////////////
@@ -85,41 +91,51 @@ namespace Engine::Visual
 
         glBindVertexArray(modelData.vao);
         ASSERT_OPENGL("Unable to bind vertex buffer for model: {}", model.GetId());
+        m_frameStats.bufferBinds++;
+        m_frameStats.vertices += modelData.vertices.size();
 
         glUniformMatrix4fv(m_modelMatrixLoc, 1, GL_FALSE, glm::value_ptr(worldMatrix));
+        m_frameStats.uniformUpdates++;
+        m_frameStats.uploadedBytes += sizeof(worldMatrix);
 
         std::unordered_map<int, std::vector<size_t>> materialMeshes;
-		for (size_t i = 0; i < modelData.meshes.size(); i++)
-		{
-			materialMeshes[modelData.meshes[i].materialId].push_back(i);
-		}
+        for (size_t i = 0; i < modelData.meshes.size(); i++)
+        {
+            materialMeshes[modelData.meshes[i].materialId].push_back(i);
+        }
 
-		for (const auto& [materialId, meshIndices] : materialMeshes)
-		{
-			const Material& material = materialId != -1 ? modelData.materials[materialId]: m_defaultMaterial;
-			glUniform3fv(m_ambientColorLoc, 1, glm::value_ptr(material.ambientColor));
-			glUniform3fv(m_diffuseColorLoc, 1, glm::value_ptr(material.diffuseColor));
-			glUniform3fv(m_specularColorLoc, 1, glm::value_ptr(material.specularColor));
-			glUniform1f(m_shininessLoc, material.shininess);
+        for (const auto& [materialId, meshIndices] : materialMeshes)
+        {
+            const Material& material = materialId != -1 ? modelData.materials[materialId]: m_defaultMaterial;
+            glUniform3fv(m_ambientColorLoc, 1, glm::value_ptr(material.ambientColor));
+            glUniform3fv(m_diffuseColorLoc, 1, glm::value_ptr(material.diffuseColor));
+            glUniform3fv(m_specularColorLoc, 1, glm::value_ptr(material.specularColor));
+            glUniform1f(m_shininessLoc, material.shininess);
             glUniform1f(m_useDiffuseTextureLoc, material.useDiffuseTexture);
             ASSERT_OPENGL("Unable to set material properties for mesh of model: {}", model.GetId());
+            m_frameStats.uniformUpdates += 5;
+            m_frameStats.uploadedBytes += 3 * sizeof(glm::vec3) + 2 * sizeof(float);
 
-			glActiveTexture(GL_TEXTURE0);
-			glBindTexture(GL_TEXTURE_2D, getTexture(material.useDiffuseTexture ? material.diffuseTextureId: m_defaultMaterial.diffuseTextureId));
-			glUniform1i(glGetUniformLocation(m_shaderProgram, "diffuseTexture"), 0);
+            glActiveTexture(GL_TEXTURE0);
+            glBindTexture(GL_TEXTURE_2D, getTexture(material.useDiffuseTexture ? material.diffuseTextureId: m_defaultMaterial.diffuseTextureId));
+            glUniform1i(glGetUniformLocation(m_shaderProgram, "diffuseTexture"), 0);
             ASSERT_OPENGL("Unable to set texture for mesh of model: {}", model.GetId());
+            m_frameStats.resourceBinds++;
+            m_frameStats.uniformUpdates++;
 
-			for (size_t meshIndex : meshIndices)
-			{
-				const SubMesh& mesh = modelData.meshes[meshIndex];
+            for (size_t meshIndex : meshIndices)
+            {
+                const SubMesh& mesh = modelData.meshes[meshIndex];
 
                 glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh.indexBuffer);
                 ASSERT_OPENGL("Unable to bind index buffer for mesh of model: {}", model.GetId());
+                m_frameStats.bufferBinds++;
 
-				glDrawElements(GL_TRIANGLES, mesh.indices.size(), GL_UNSIGNED_INT, 0);
-				ASSERT_OPENGL("Unable to draw mesh of model: {}", model.GetId());
-			}
-		}
+                glDrawElements(GL_TRIANGLES, mesh.indices.size(), GL_UNSIGNED_INT, 0);
+                ASSERT_OPENGL("Unable to draw mesh of model: {}", model.GetId());
+                m_frameStats.addDrawCall(mesh.indices.size());
+            }
+        }
 
         glBindVertexArray(0);
     }
@@ -135,6 +151,8 @@ namespace Engine::Visual
 
     void OpenGLRenderer::postRenderUI()
     {
+        writeTimerQuery(1);
+        m_uiTimerQueryWritten = true;
         ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
     }
 
@@ -142,8 +160,28 @@ namespace Engine::Visual
 
     void OpenGLRenderer::render()
     {
+        // without a UI pass the scene pass takes the whole frame
+        if (!m_uiTimerQueryWritten)
+        {
+            writeTimerQuery(1);
+        }
+        writeTimerQuery(2);
+        m_timerQueriesPending[m_timerFrame % TIMER_FRAMES_COUNT] = m_timerQueriesSupported;
+        m_timerFrame++;
+
         SwapBuffers(m_hdc);
         ASSERT_OPENGL("Unable to swap buffers and render");
+        ASSERT_OPENGL_FRAME();
+
+        m_lastFrameStats = m_frameStats;
+        m_frameStats = {};
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+
+    RendererFrameStats OpenGLRenderer::getFrameStats() const
+    {
+        return m_lastFrameStats;
     }
 
     ////////////////////////////////////////////////////////////////////////
@@ -175,6 +213,7 @@ namespace Engine::Visual
         glGenBuffers(1, &model.vertexBuffer);
         glBindBuffer(GL_ARRAY_BUFFER, model.vertexBuffer);
         glBufferData(GL_ARRAY_BUFFER, model.vertices.size() * sizeof(Vertex), model.vertices.data(), GL_STATIC_DRAW);
+        m_frameStats.uploadedBytes += model.vertices.size() * sizeof(Vertex);
 
         glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, position));
         glEnableVertexAttribArray(0);
@@ -190,6 +229,7 @@ namespace Engine::Visual
             glGenBuffers(1, &subMesh.indexBuffer);
             glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, subMesh.indexBuffer);
             glBufferData(GL_ELEMENT_ARRAY_BUFFER, subMesh.indices.size() * sizeof(unsigned int), subMesh.indices.data(), GL_STATIC_DRAW);
+            m_frameStats.uploadedBytes += subMesh.indices.size() * sizeof(unsigned int);
         }
 
         glBindVertexArray(0);
@@ -197,21 +237,12 @@ namespace Engine::Visual
 
     ////////////////////////////////////////////////////////////////////////
 
-    bool OpenGLRenderer::loadModelFromFile(ModelData& model, const std::string& filename)
+    bool OpenGLRenderer::createModelData(ModelData& model, const ModelFile& modelFile)
     {
-        std::filesystem::path fullPath(filename);
-        std::filesystem::path matDir = fullPath.parent_path();
-
-        tinyobj::attrib_t attrib;
-        std::vector<tinyobj::shape_t> shapes;
-        std::vector<tinyobj::material_t> materials;
-        std::string warn, err;
-
-        bool success = tinyobj::LoadObj(&attrib, &shapes, &materials, &warn, &err, filename.c_str(), matDir.string().c_str());
-        if (!success) 
-        {
-            return false;
-        }
+        const tinyobj::attrib_t& attrib = modelFile.attrib;
+        const std::vector<tinyobj::shape_t>& shapes = modelFile.shapes;
+        const std::vector<tinyobj::material_t>& materials = modelFile.materials;
+        const std::filesystem::path& matDir = modelFile.materialDirectory;
 
         // Load materials
         for (const auto& mat : materials)
@@ -343,6 +374,8 @@ namespace Engine::Visual
         );
 
         glUniformMatrix4fv(m_viewMatrixLoc, 1, GL_FALSE, glm::value_ptr(m_viewMatrix));
+        m_frameStats.uniformUpdates++;
+        m_frameStats.uploadedBytes += sizeof(m_viewMatrix);
     }
 
     ////////////////////////////////////////////////////////////////////////
@@ -460,6 +493,17 @@ namespace Engine::Visual
             m_frameBuffer = 0;
         }
 
+        if (m_timerQueriesSupported)
+        {
+            for (auto& frameQueries : m_timerQueries)
+            {
+                glDeleteQueries(static_cast<GLsizei>(frameQueries.size()), frameQueries.data());
+            }
+            m_timerQueries = {};
+            m_timerQueriesPending = {};
+            m_timerQueriesSupported = false;
+        }
+
         if (m_hglrc)
         {
             wglMakeCurrent(nullptr, nullptr);
@@ -496,7 +540,7 @@ namespace Engine::Visual
 
     ////////////////////////////////////////////////////////////////////////
 
-    bool OpenGLRenderer::loadModel(const std::string& filename)
+    bool OpenGLRenderer::loadModel(const std::string& filename, const ModelFile& modelFile)
     {
         if (m_models.contains(filename))
         {
@@ -504,7 +548,7 @@ namespace Engine::Visual
         }
 
         ModelData modelData;
-        if (!loadModelFromFile(modelData, filename))
+        if (!createModelData(modelData, modelFile))
         {
             return false;
         }
@@ -538,6 +582,7 @@ namespace Engine::Visual
         glTexImage2D(GL_TEXTURE_2D, 0, GL_SRGB8_ALPHA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
         glGenerateMipmap(GL_TEXTURE_2D);
         stbi_image_free(data);
+        m_frameStats.uploadedBytes += static_cast<uint64_t>(width) * height * 4;
 
         m_textures.emplace(filename, texture);
         return true;
@@ -699,6 +744,8 @@ namespace Engine::Visual
         glm::vec3 lightDirection = glm::vec3(directionNormalized.x, directionNormalized.y, directionNormalized.z);
         glUniform3fv(m_lightDirectionLoc, 1, glm::value_ptr(lightDirection));
         glUniform1f(m_lightIntensityLoc, intensity);
+        m_frameStats.uniformUpdates += 2;
+        m_frameStats.uploadedBytes += sizeof(lightDirection) + sizeof(intensity);
     }
 
     ////////////////////////////////////////////////////////////////////////
@@ -788,6 +835,72 @@ namespace Engine::Visual
 
     ////////////////////////////////////////////////////////////////////////
 
+    void OpenGLRenderer::createTimerQueries()
+    {
+        // timestamps need GL 3.3 or ARB_timer_query, without them the renderer just reports no GPU times
+        if (!GLEW_VERSION_3_3 && !GLEW_ARB_timer_query)
+        {
+            return;
+        }
+
+        GLint counterBits = 0;
+        glGetQueryiv(GL_TIMESTAMP, GL_QUERY_COUNTER_BITS, &counterBits);
+        if (counterBits == 0)
+        {
+            return;
+        }
+
+        for (auto& frameQueries : m_timerQueries)
+        {
+            glGenQueries(static_cast<GLsizei>(frameQueries.size()), frameQueries.data());
+        }
+        ASSERT_OPENGL("Unable to create timer queries");
+        m_timerQueriesSupported = true;
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+
+    void OpenGLRenderer::writeTimerQuery(size_t query)
+    {
+        if (!m_timerQueriesSupported)
+        {
+            return;
+        }
+
+        glQueryCounter(m_timerQueries[m_timerFrame % TIMER_FRAMES_COUNT][query], GL_TIMESTAMP);
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+
+    void OpenGLRenderer::readTimerQueries()
+    {
+        size_t frame = m_timerFrame % TIMER_FRAMES_COUNT;
+        if (!m_timerQueriesPending[frame])
+        {
+            return;
+        }
+        m_timerQueriesPending[frame] = false;
+
+        // the frame end query completes last, a frame the GPU hasn't finished yet is dropped instead of waited for
+        const auto& frameQueries = m_timerQueries[frame];
+        GLint available = 0;
+        glGetQueryObjectiv(frameQueries.back(), GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available)
+        {
+            return;
+        }
+
+        std::array<GLuint64, FRAME_TIMER_QUERIES_COUNT> timestamps{};
+        for (size_t i = 0; i < FRAME_TIMER_QUERIES_COUNT; i++)
+        {
+            glGetQueryObjectui64v(frameQueries[i], GL_QUERY_RESULT, &timestamps[i]);
+        }
+
+        m_frameStats.addGpuFrameTimes(timestamps[1] - timestamps[0], timestamps[2] - timestamps[1]);
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+
     void OpenGLRenderer::initUI()
     {
         ImGui_ImplOpenGL3_Init("#version 450");
@@ -9,6 +9,7 @@
 #include "IRenderer.h"
 #include <string>
 #include <vector>
+#include <array>
 
 namespace Engine::Visual
 {
@@ -29,7 +30,7 @@ namespace Engine::Visual
         void postRenderUI() override;
         void render() override;
 
-        bool loadModel(const std::string& filename) override;
+        bool loadModel(const std::string& filename, const ModelFile& modelFile) override;
         bool loadTexture(const std::string& filename) override;
 
         void setCameraProperties(const Utils::Vector3& position, const Utils::Vector3& rotation) override;
@@ -40,6 +41,7 @@ namespace Engine::Visual
         bool unloadTexture(const std::string& filename) override;
         bool unloadModel(const std::string& filename) override;
         void cleanUp() override;
+        RendererFrameStats getFrameStats() const override;
 
     private:
         struct Vertex
@@ -88,15 +90,22 @@ namespace Engine::Visual
         void createFrameBuffer();
         void createViewport();
         void createDefaultMaterial();
+        void createTimerQueries();
         void initUI();
         void cleanUpUI();
 
         GLuint createShader(const std::string& source, GLenum shaderType);
         const GLuint& getTexture(const std::string& textureId) const;
         void createBuffersForModel(ModelData& model);
-        bool loadModelFromFile(ModelData& model, const std::string& filename);
+        bool createModelData(ModelData& model, const ModelFile& modelFile);
+        void writeTimerQuery(size_t query);
+        void readTimerQueries();
 
     private:
+        // queries of a frame: frame start, UI pass start, frame end, read back when the ring comes around
+        static const size_t FRAME_TIMER_QUERIES_COUNT = 3;
+        static const size_t TIMER_FRAMES_COUNT = 4;
+
         HWND m_hwnd;
         HDC m_hdc;
         HGLRC m_hglrc;
@@ -123,5 +132,14 @@ namespace Engine::Visual
         std::unordered_map<std::string, GLuint> m_textures;
         std::unordered_map<std::string, ModelData> m_models;
 
+        bool m_timerQueriesSupported = false;
+        std::array<std::array<GLuint, FRAME_TIMER_QUERIES_COUNT>, TIMER_FRAMES_COUNT> m_timerQueries{};
+        std::array<bool, TIMER_FRAMES_COUNT> m_timerQueriesPending{};
+        size_t m_timerFrame = 0;
+        bool m_uiTimerQueryWritten = false;
+
+        RendererFrameStats m_frameStats;
+        RendererFrameStats m_lastFrameStats;
+
     };
 }
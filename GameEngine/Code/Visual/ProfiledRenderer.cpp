@@ -0,0 +1,145 @@
+#include "ProfiledRenderer.h"
+
+#include "Utils/Profiler.h"
+
+namespace Engine::Visual
+{
+    ////////////////////////////////////////////////////////////////////////
+
+    ProfiledRenderer::ProfiledRenderer(std::unique_ptr<IRenderer> renderer): m_renderer(std::move(renderer))
+    {
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+
+    void ProfiledRenderer::init(const Window& window)
+    {
+        PROFILE_ZONE("IRenderer::init");
+        m_renderer->init(window);
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+
+    void ProfiledRenderer::clearBackground(float r, float g, float b, float a)
+    {
+        PROFILE_ZONE("IRenderer::clearBackground");
+        m_renderer->clearBackground(r, g, b, a);
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+
+    void ProfiledRenderer::draw(
+        const IModelInstance& model,
+        const Utils::Vector3& position,
+        const Utils::Vector3& rotation,
+        const Utils::Vector3& scale)
+    {
+        PROFILE_ZONE("IRenderer::draw");
+        m_renderer->draw(model, position, rotation, scale);
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+
+    void ProfiledRenderer::preRenderUI()
+    {
+        PROFILE_ZONE("IRenderer::preRenderUI");
+        m_renderer->preRenderUI();
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+
+    void ProfiledRenderer::postRenderUI()
+    {
+        PROFILE_ZONE("IRenderer::postRenderUI");
+        m_renderer->postRenderUI();
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+
+    void ProfiledRenderer::render()
+    {
+        PROFILE_ZONE("IRenderer::render");
+        m_renderer->render();
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+
+    bool ProfiledRenderer::loadModel(const std::string& filename, const ModelFile& modelFile)
+    {
+        PROFILE_ZONE("IRenderer::loadModel");
+        return m_renderer->loadModel(filename, modelFile);
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+
+    bool ProfiledRenderer::loadTexture(const std::string& filename)
+    {
+        PROFILE_ZONE("IRenderer::loadTexture");
+        return m_renderer->loadTexture(filename);
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+
+    void ProfiledRenderer::setCameraProperties(const Utils::Vector3& position, const Utils::Vector3& rotation)
+    {
+        PROFILE_ZONE("IRenderer::setCameraProperties");
+        m_renderer->setCameraProperties(position, rotation);
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+
+    void ProfiledRenderer::setLightProperties(const Utils::Vector3& direction, float intensity)
+    {
+        PROFILE_ZONE("IRenderer::setLightProperties");
+        m_renderer->setLightProperties(direction, intensity);
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<IModelInstance> ProfiledRenderer::createModelInstance(const std::string& filename)
+    {
+        PROFILE_ZONE("IRenderer::createModelInstance");
+        return m_renderer->createModelInstance(filename);
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+
+    bool ProfiledRenderer::destroyModelInstance(IModelInstance& modelInstance)
+    {
+        PROFILE_ZONE("IRenderer::destroyModelInstance");
+        return m_renderer->destroyModelInstance(modelInstance);
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+
+    bool ProfiledRenderer::unloadTexture(const std::string& filename)
+    {
+        PROFILE_ZONE("IRenderer::unloadTexture");
+        return m_renderer->unloadTexture(filename);
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+
+    bool ProfiledRenderer::unloadModel(const std::string& filename)
+    {
+        PROFILE_ZONE("IRenderer::unloadModel");
+        return m_renderer->unloadModel(filename);
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+
+    void ProfiledRenderer::cleanUp()
+    {
+        PROFILE_ZONE("IRenderer::cleanUp");
+        m_renderer->cleanUp();
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+
+    RendererFrameStats ProfiledRenderer::getFrameStats() const
+    {
+        return m_renderer->getFrameStats();
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+}
\ No newline at end of file
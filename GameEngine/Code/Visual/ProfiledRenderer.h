@@ -0,0 +1,44 @@
+#pragma once
+
+#include <memory>
+
+#include "IRenderer.h"
+
+namespace Engine::Visual
+{
+    // Forwards every call to the wrapped renderer inside a profiler zone.
+    class ProfiledRenderer : public IRenderer
+    {
+    public:
+        explicit ProfiledRenderer(std::unique_ptr<IRenderer> renderer);
+
+        void init(const Window& window) override;
+        void clearBackground(float r, float g, float b, float a) override;
+
+        void draw(
+            const IModelInstance& model,
+            const Utils::Vector3& position,
+            const Utils::Vector3& rotation,
+            const Utils::Vector3& scale) override;
+
+        void preRenderUI() override;
+        void postRenderUI() override;
+        void render() override;
+
+        bool loadModel(const std::string& filename, const ModelFile& modelFile) override;
+        bool loadTexture(const std::string& filename) override;
+
+        void setCameraProperties(const Utils::Vector3& position, const Utils::Vector3& rotation) override;
+        void setLightProperties(const Utils::Vector3& direction, float intensity) override;
+        std::unique_ptr<IModelInstance> createModelInstance(const std::string& filename) override;
+
+        bool destroyModelInstance(IModelInstance& modelInstance) override;
+        bool unloadTexture(const std::string& filename) override;
+        bool unloadModel(const std::string& filename) override;
+        void cleanUp() override;
+        RendererFrameStats getFrameStats() const override;
+
+    private:
+        std::unique_ptr<IRenderer> m_renderer;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,77 @@
+#include "RendererFrameStats.h"
+
+namespace Engine::Visual
+{
+    ////////////////////////////////////////////////////////////////////////
+
+    void RendererFrameStats::addDrawCall(uint64_t indicesCount)
+    {
+        drawCalls++;
+        indices += indicesCount;
+        triangles += indicesCount / 3;
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+
+    void RendererFrameStats::addGpuFrameTimes(uint64_t scenePassTime, uint64_t uiPassTime)
+    {
+        gpuTimedFrames++;
+        gpuFrameTime += scenePassTime + uiPassTime;
+        gpuScenePassTime += scenePassTime;
+        gpuUIPassTime += uiPassTime;
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+
+    RendererFrameStats& RendererFrameStats::operator+=(const RendererFrameStats& other)
+    {
+        drawCalls += other.drawCalls;
+        triangles += other.triangles;
+        vertices += other.vertices;
+        indices += other.indices;
+        pipelineBinds += other.pipelineBinds;
+        bufferBinds += other.bufferBinds;
+        resourceBinds += other.resourceBinds;
+        uniformUpdates += other.uniformUpdates;
+        uploadedBytes += other.uploadedBytes;
+        gpuTimedFrames += other.gpuTimedFrames;
+        gpuFrameTime += other.gpuFrameTime;
+        gpuScenePassTime += other.gpuScenePassTime;
+        gpuUIPassTime += other.gpuUIPassTime;
+        gpuUploadTime += other.gpuUploadTime;
+        return *this;
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+
+    RendererFrameStats RendererFrameStats::operator/(uint64_t divisor) const
+    {
+        if (divisor == 0)
+        {
+            return {};
+        }
+
+        RendererFrameStats result;
+        result.drawCalls = drawCalls / divisor;
+        result.triangles = triangles / divisor;
+        result.vertices = vertices / divisor;
+        result.indices = indices / divisor;
+        result.pipelineBinds = pipelineBinds / divisor;
+        result.bufferBinds = bufferBinds / divisor;
+        result.resourceBinds = resourceBinds / divisor;
+        result.uniformUpdates = uniformUpdates / divisor;
+        result.uploadedBytes = uploadedBytes / divisor;
+
+        if (gpuTimedFrames > 0)
+        {
+            result.gpuTimedFrames = 1;
+            result.gpuFrameTime = gpuFrameTime / gpuTimedFrames;
+            result.gpuScenePassTime = gpuScenePassTime / gpuTimedFrames;
+            result.gpuUIPassTime = gpuUIPassTime / gpuTimedFrames;
+            result.gpuUploadTime = gpuUploadTime / gpuTimedFrames;
+        }
+        return result;
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+}
\ No newline at end of file
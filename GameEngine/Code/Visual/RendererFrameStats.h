@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Engine::Visual
+{
+    // What a backend submitted during one frame, excluding the UI.
+    struct RendererFrameStats
+    {
+        uint64_t drawCalls = 0;
+        uint64_t triangles = 0;
+        uint64_t vertices = 0;
+        uint64_t indices = 0;
+        uint64_t pipelineBinds = 0;
+        uint64_t bufferBinds = 0;
+        uint64_t resourceBinds = 0;
+        uint64_t uniformUpdates = 0;
+        uint64_t uploadedBytes = 0;
+
+        // GPU timings in nanoseconds, backends resolve them a few frames late and only some frames have them
+        uint64_t gpuTimedFrames = 0;
+        uint64_t gpuFrameTime = 0;
+        uint64_t gpuScenePassTime = 0;
+        uint64_t gpuUIPassTime = 0;
+        uint64_t gpuUploadTime = 0;
+
+        void addDrawCall(uint64_t indicesCount);
+        void addGpuFrameTimes(uint64_t scenePassTime, uint64_t uiPassTime);
+
+        RendererFrameStats& operator+=(const RendererFrameStats& other);
+        // the GPU timings are averaged over the frames that have them rather than over divisor
+        RendererFrameStats operator/(uint64_t divisor) const;
+    };
+}
\ No newline at end of file
@@ -6,6 +6,8 @@
 #include "Managers/GameController.h"
 #include "Events/UIEvents.h"
 #include "Events/StatsEvents.h"
+#include "Events/AssetEvents.h"
+#include "Utils/AllocationTracker.h"
 
 namespace Engine::Visual
 {
@@ -33,10 +35,23 @@ namespace Engine::Visual
             }
         );
 
+        m_systemsTimingListenerId = m_eventsManager.subscribe<Events::SystemsTimingUpdate>(
+            [this](const Events::SystemsTimingUpdate& i_event)
+            {
+                m_systemTimings = i_event.systems;
+            }
+        );
+
 		m_warningListenerId = m_eventsManager.subscribe<Events::SendWarning>([this](const Events::SendWarning& i_event) {onWarningRequested(i_event.message);});
 
-        m_eventsManager.emit<Events::StatsRecordingUpdate>(Events::StatsRecordingUpdate{false});
-		m_isRecording = false;
+        m_sceneReloadedListenerId = m_eventsManager.subscribe<Events::SceneReloaded>(
+            [this](const Events::SceneReloaded& i_event)
+            {
+                m_lastSceneSwitch = i_event;
+            }
+        );
+
+        reset();
 
         IMGUI_CHECKVERSION();
         ImGui::CreateContext();
@@ -49,6 +64,14 @@ namespace Engine::Visual
 
 	////////////////////////////////////////////////////////////////////////
 
+	void UIController::reset()
+	{
+        m_eventsManager.emit<Events::StatsRecordingUpdate>(Events::StatsRecordingUpdate{false});
+		m_isRecording = false;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+
 	void UIController::setRenderer(const std::string& rendererName)
 	{
 		m_rendererName = rendererName;
@@ -157,6 +180,8 @@ namespace Engine::Visual
 
 		m_eventsManager.unsubscribe<Events::StatsUpdate>(m_statsUpdateListenerId);
 		m_eventsManager.unsubscribe<Events::SendWarning>(m_warningListenerId);
+		m_eventsManager.unsubscribe<Events::SceneReloaded>(m_sceneReloadedListenerId);
+		m_eventsManager.unsubscribe<Events::SystemsTimingUpdate>(m_systemsTimingListenerId);
     }
 
 
@@ -175,10 +200,52 @@ namespace Engine::Visual
         drawStat("FPS:", "", m_statsData.avgFPS, 1);
         drawStat("Frame Time:", " ms", 1000.0f * m_statsData.avgFrameTime, 3);
         drawStat("99th Percentile Frame Time:", " ms", 1000.0f * m_statsData.frameTimePercentile99, 3);
+        drawStat("Median Pacing Error:", " ms", 1000.0f * m_statsData.pacingErrorMedian, 3);
+        drawStat("99th Percentile Pacing Error:", " ms", 1000.0f * m_statsData.pacingErrorPercentile99, 3);
         drawStat("RAM Usage:", " MB", m_statsData.memoryUsage, 2);
         drawStat("VRAM Usage:", " MB", m_statsData.gpuMemoryUsage, 2);
         drawStat("CPU Usage:", "%%", m_statsData.cpuUsage, 2);
         drawStat("GPU Usage:", "%%", m_statsData.gpuUsage, 2);
+        drawStat("Process CPU Usage:", "%%", m_statsData.processCpuUsage, 2);
+        drawStat("Main Thread CPU Usage:", "%%", m_statsData.mainThreadCpuUsage, 2);
+        drawStat("Worker Threads CPU Usage:", "%%", m_statsData.workerThreadsCpuUsage, 2);
+        if (m_statsData.rendererStats.gpuTimedFrames > 0)
+        {
+            drawStat("GPU Frame Time:", " ms", 1000.0f * m_statsData.gpuFrameTime, 3);
+            drawStat("GPU Scene Pass Time:", " ms", 1000.0f * m_statsData.gpuScenePassTime, 3);
+            drawStat("GPU UI Pass Time:", " ms", 1000.0f * m_statsData.gpuUIPassTime, 3);
+        }
+        drawStat("Draw Calls:", "", (float)m_statsData.rendererStats.drawCalls, 0);
+        drawStat("Triangles:", "", (float)m_statsData.rendererStats.triangles, 0);
+        if (Utils::AllocationTracker::isEnabled())
+        {
+            drawStat("Allocations Per Frame:", "", m_statsData.allocationsPerFrame, 1);
+        }
+
+        if (m_lastSceneSwitch)
+        {
+            ImGui::Separator();
+            drawStat("Last Scene Switch:", " ms", 1000.0f * m_lastSceneSwitch->duration, 1);
+            drawStat("Longest Switch Frame:", " ms", 1000.0f * m_lastSceneSwitch->longestFrame, 1);
+            drawStat("Models Loaded:", "", (float)m_lastSceneSwitch->loadedModels, 0);
+            drawStat("Models Reused:", "", (float)m_lastSceneSwitch->reusedModels, 0);
+            drawStat("Models Evicted:", "", (float)m_lastSceneSwitch->evictedModels, 0);
+        }
+
+        if (m_systemTimings.empty())
+        {
+            return;
+        }
+
+        ImGui::Separator();
+        for (const SystemTimingStats& timing : m_systemTimings)
+        {
+            drawStat(timing.name + ":", " ms", 1000.0f * timing.meanTime, 3);
+            if (timing.budget > 0.0f)
+            {
+                drawStat(timing.name + " Budget Overruns:", "", (float)timing.budgetOverruns, 0);
+            }
+        }
     }
 
     ////////////////////////////////////////////////////////////////////////
@@ -209,6 +276,29 @@ namespace Engine::Visual
 
         ImGui::Separator();
 
+        ImGui::BeginGroup();
+        int currentFrameRateLimit = (int)GameController::get().getFrameLimiter().getTargetFPS();
+        if (ImGui::BeginCombo("Frame Rate Limit", getFrameRateLimitLabel(currentFrameRateLimit).c_str()))
+        {
+            for (int frameRateLimit : k_frameRateLimits)
+            {
+                bool is_selected = (frameRateLimit == currentFrameRateLimit);
+                if (ImGui::Selectable(getFrameRateLimitLabel(frameRateLimit).c_str(), is_selected))
+                {
+                    m_eventsManager.emit(Events::FrameLimitUpdate{ (float)frameRateLimit });
+                }
+
+                if (is_selected)
+                {
+                    ImGui::SetItemDefaultFocus();
+                }
+            }
+            ImGui::EndCombo();
+        }
+        ImGui::EndGroup();
+
+        ImGui::Separator();
+
         ImGui::BeginGroup();
         if (ImGui::Button("Select config file", ImVec2(width, 20)))
         {
@@ -308,4 +398,15 @@ namespace Engine::Visual
     }
 
     ////////////////////////////////////////////////////////////////////////
+
+    std::string UIController::getFrameRateLimitLabel(int frameRateLimit) const
+    {
+        if (frameRateLimit <= 0)
+        {
+            return "Uncapped";
+        }
+        return std::format("{} FPS", frameRateLimit);
+    }
+
+    ////////////////////////////////////////////////////////////////////////
 }
\ No newline at end of file
@@ -1,9 +1,11 @@
 #pragma once
 
 #include <string>
+#include <optional>
 
 #include "Visual/Window.h"
 #include "Events/StatsEvents.h"
+#include "Events/AssetEvents.h"
 #include "Managers/EventsManager.h"
 
 namespace Engine::Visual
@@ -14,6 +16,7 @@ namespace Engine::Visual
 	public:
 		UIController(std::vector<std::string> rendererNames);
 		void init();
+		void reset();
 		void setRenderer(const std::string& rendererName);
 		void render(float dt);
 		void cleanUp();
@@ -21,6 +24,7 @@ namespace Engine::Visual
 
 		inline static const float k_warningTime = 5.0f;
 		inline static const float k_maxRecordingTime = 60.0f;
+		inline static const std::vector<int> k_frameRateLimits = { 0, 30, 60, 120, 144, 240 };
 
 	private:
 		void drawStat(const std::string& label, const std::string& unit, float value, size_t precision, size_t totalWidth = 43);
@@ -28,6 +32,7 @@ namespace Engine::Visual
 		void renderPerformance();
 		void renderSettings();
 		void renderStatsRecorder();
+		std::string getFrameRateLimitLabel(int frameRateLimit) const;
 
 	private:
 		const Visual::Window& m_window;
@@ -38,9 +43,13 @@ namespace Engine::Visual
 		bool m_isRecording;
 		float m_recordingTime;
 		StatsData m_statsData{};
+		std::vector<SystemTimingStats> m_systemTimings;
+		std::optional<Events::SceneReloaded> m_lastSceneSwitch;
 
 		EventListenerID m_statsUpdateListenerId = -1;
 		EventListenerID m_warningListenerId = -1;
+		EventListenerID m_sceneReloadedListenerId = -1;
+		EventListenerID m_systemsTimingListenerId = -1;
 
 		float m_warningTimer;
 		std::string m_warningMessage;
@@ -33,6 +33,7 @@ namespace Engine::Visual
 		createDescriptorSetLayout();
 		createGraphicsPipeline();
 		createCommandPool();
+		createTimestampQueryPool();
 		createDepthResources();
 		createFramebuffers();
 		createDescriptorPool();
@@ -64,6 +65,9 @@ namespace Engine::Visual
 		vkWaitForFences(m_device, 1, &m_inFlightFences[m_currentImageInFlight], VK_TRUE, UINT64_MAX);
 		vkResetFences(m_device, 1, &m_inFlightFences[m_currentImageInFlight]);
 
+		// the fence covers the last submission that used this frame slot, so its queries resolve without stalling
+		readFrameTimestamps(m_currentImageInFlight);
+
 		const VkCommandBuffer& commandBuffer = m_commandBuffers[m_imageIndex];
 		VkResult resetResult = vkResetCommandBuffer(m_commandBuffers[m_imageIndex], 0);
 		if (!validateResult(resetResult, "Failed to reset command buffer"))
@@ -80,6 +84,14 @@ namespace Engine::Visual
 			return;
 		}
 
+		uint32_t firstFrameQuery = m_currentImageInFlight * FRAME_TIMESTAMPS_COUNT;
+		if (m_timestampQueryPool != VK_NULL_HANDLE)
+		{
+			vkCmdResetQueryPool(commandBuffer, m_timestampQueryPool, firstFrameQuery, FRAME_TIMESTAMPS_COUNT);
+		}
+		writeTimestamp(commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, firstFrameQuery);
+		m_uiTimestampWritten = false;
+
 		VkRenderPassBeginInfo renderPassInfo{};
 		renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
 		renderPassInfo.renderPass = m_renderPass;
@@ -97,6 +109,7 @@ namespace Engine::Visual
 		vkCmdBeginRenderPass(commandBuffer, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
 
 		vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_graphicsPipeline);
+		m_frameStats.pipelineBinds++;
 	}
 
 	////////////////////////////////////////////////////////////////////////
@@ -121,13 +134,17 @@ namespace Engine::Visual
 
 		bool setUboMemoryResult = setBufferMemoryData(modelInstance.uniformBufferMemory, &m_ubo, sizeof(m_ubo));
 		ASSERT(setUboMemoryResult, "Failed to set memory data for uniform buffer");
+		m_frameStats.uniformUpdates++;
 
 		VkBuffer vertexBuffers[] = { modelData.vertexBuffer };
 		VkDeviceSize offsets[] = { 0 };
 		vkCmdBindVertexBuffers(commandBuffer, 0, 1, vertexBuffers, offsets);
+		m_frameStats.bufferBinds++;
+		m_frameStats.vertices += modelData.vertices.size();
 
 		std::array<VkDescriptorSet, 1> instanceDescriptorSets{ modelInstance.descriptorSet };
 		vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipelineLayout, 0, static_cast<uint32_t>(instanceDescriptorSets.size()), instanceDescriptorSets.data(), 0, nullptr);
+		m_frameStats.resourceBinds += instanceDescriptorSets.size();
 
 		for (const auto& mat : modelData.materials)
 		{
@@ -140,6 +157,7 @@ namespace Engine::Visual
 
 			bool setMboMemoryResult = setBufferMemoryData(mat.materialBufferMemory, &mbo, sizeof(mbo));
 			ASSERT(setMboMemoryResult, "Failed to set memory data for material buffer");
+			m_frameStats.uniformUpdates++;
 		}
 
 		std::unordered_map<int, std::vector<size_t>> materialMeshes;
@@ -154,11 +172,14 @@ namespace Engine::Visual
 			const TextureData& texture = getTexture(material.useDiffuseTexture ? material.diffuseTextureId: m_defaultMaterial.diffuseTextureId);
 			std::array<VkDescriptorSet, 2> materialDescriptorSets{ material.descriptorSet, texture.descriptorSet };
 			vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipelineLayout, 1, static_cast<uint32_t>(materialDescriptorSets.size()), materialDescriptorSets.data(), 0, nullptr);
+			m_frameStats.resourceBinds += materialDescriptorSets.size();
 			for (size_t meshIndex : meshIndices)
 			{
 				const SubMesh& mesh = modelData.meshes[meshIndex];
 				vkCmdBindIndexBuffer(commandBuffer, mesh.indexBuffer, 0, VK_INDEX_TYPE_UINT32);
 				vkCmdDrawIndexed(commandBuffer, static_cast<uint32_t>(mesh.indices.size()), 1, 0, 0, 0);
+				m_frameStats.bufferBinds++;
+				m_frameStats.addDrawCall(mesh.indices.size());
 			}
 
 		}
@@ -177,6 +198,8 @@ namespace Engine::Visual
 	void VulkanRenderer::postRenderUI()
 	{
 		VkCommandBuffer commandBuffer = m_commandBuffers[m_imageIndex];
+		writeTimestamp(commandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, m_currentImageInFlight * FRAME_TIMESTAMPS_COUNT + 1);
+		m_uiTimestampWritten = true;
 		ImGui_ImplVulkan_RenderDrawData(ImGui::GetDrawData(), commandBuffer);
 	}
 
@@ -184,9 +207,20 @@ namespace Engine::Visual
 
 	void VulkanRenderer::render()
 	{
+		m_lastFrameStats = m_frameStats;
+		m_frameStats = {};
+
 		VkCommandBuffer commandBuffer = m_commandBuffers[m_imageIndex];
+		uint32_t firstFrameQuery = m_currentImageInFlight * FRAME_TIMESTAMPS_COUNT;
+
+		// without a UI pass the scene pass takes the whole frame
+		if (!m_uiTimestampWritten)
+		{
+			writeTimestamp(commandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, firstFrameQuery + 1);
+		}
 
 		vkCmdEndRenderPass(commandBuffer);
+		writeTimestamp(commandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, firstFrameQuery + 2);
 		VkResult endCommandBufferResult = vkEndCommandBuffer(commandBuffer);
 		if (!validateResult(endCommandBufferResult, "Failed to record command buffer"))
 		{
@@ -213,6 +247,7 @@ namespace Engine::Visual
 		{
 			return;
 		}
+		m_frameTimestampsPending[m_currentImageInFlight] = m_timestampQueryPool != VK_NULL_HANDLE;
 
 		VkPresentInfoKHR presentInfo{};
 		presentInfo.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
@@ -238,6 +273,13 @@ namespace Engine::Visual
 
 	////////////////////////////////////////////////////////////////////////
 
+	RendererFrameStats VulkanRenderer::getFrameStats() const
+	{
+		return m_lastFrameStats;
+	}
+
+	////////////////////////////////////////////////////////////////////////
+
 	bool VulkanRenderer::createBuffersForModel(ModelData& model)
 	{
 		if (!createVertexBuffer(model))
@@ -307,21 +349,12 @@ namespace Engine::Visual
 
 	////////////////////////////////////////////////////////////////////////
 
-	bool VulkanRenderer::loadModelFromFile(ModelData& model, const std::string& filename)
+	bool VulkanRenderer::createModelData(ModelData& model, const ModelFile& modelFile)
 	{
-		std::filesystem::path fullPath(filename);
-		std::filesystem::path matDir = fullPath.parent_path();
-
-		tinyobj::attrib_t attrib;
-		std::vector<tinyobj::shape_t> shapes;
-		std::vector<tinyobj::material_t> materials;
-		std::string warn, err;
-
-		bool success = tinyobj::LoadObj(&attrib, &shapes, &materials, &warn, &err, filename.c_str(), matDir.string().c_str());
-		if (!success) 
-		{
-			return false;
-		}
+		const tinyobj::attrib_t& attrib = modelFile.attrib;
+		const std::vector<tinyobj::shape_t>& shapes = modelFile.shapes;
+		const std::vector<tinyobj::material_t>& materials = modelFile.materials;
+		const std::filesystem::path& matDir = modelFile.materialDirectory;
 
 		// Load materials
 		for (const auto& mat : materials)
@@ -424,7 +457,7 @@ namespace Engine::Visual
 
 	////////////////////////////////////////////////////////////////////////
 
-	bool VulkanRenderer::loadModel(const std::string& filename)
+	bool VulkanRenderer::loadModel(const std::string& filename, const ModelFile& modelFile)
 	{
 		if (m_models.contains(filename))
 		{
@@ -432,7 +465,7 @@ namespace Engine::Visual
 		}
 
 		ModelData modelData;
-		if (!loadModelFromFile(modelData, filename))
+		if (!createModelData(modelData, modelFile))
 		{
 			return false;
 		}
@@ -702,6 +735,7 @@ namespace Engine::Visual
 
 		memcpy(mappedData, data, size);
 		vkUnmapMemory(m_device, memory);
+		m_frameStats.uploadedBytes += size;
 
 		return true;
 	}
@@ -1066,6 +1100,12 @@ namespace Engine::Visual
 			return VK_NULL_HANDLE;
 		}
 
+		if (m_timestampQueryPool != VK_NULL_HANDLE)
+		{
+			vkCmdResetQueryPool(commandBuffer, m_timestampQueryPool, UPLOAD_TIMESTAMPS_OFFSET, 2);
+		}
+		writeTimestamp(commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, UPLOAD_TIMESTAMPS_OFFSET);
+
 		return commandBuffer;
 	}
 
@@ -1073,6 +1113,7 @@ namespace Engine::Visual
 
 	void VulkanRenderer::endSingleTimeCommands(VkCommandBuffer commandBuffer)
 	{
+		writeTimestamp(commandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, UPLOAD_TIMESTAMPS_OFFSET + 1);
 		VkResult endCommandBufferResult = vkEndCommandBuffer(commandBuffer);
 		if (!validateResult(endCommandBufferResult, "Failed to record command buffer"))
 		{
@@ -1095,11 +1136,70 @@ namespace Engine::Visual
 			return;
 		}
 
+		// the queue is already idle, so the upload timestamps are read right away
+		if (m_timestampQueryPool != VK_NULL_HANDLE)
+		{
+			std::array<uint64_t, 2> timestamps{};
+			VkResult queryResult = vkGetQueryPoolResults(m_device, m_timestampQueryPool, UPLOAD_TIMESTAMPS_OFFSET, 2, sizeof(timestamps), timestamps.data(), sizeof(uint64_t), VK_QUERY_RESULT_64_BIT);
+			if (queryResult == VK_SUCCESS)
+			{
+				m_frameStats.gpuUploadTime += getTimestampsDuration(timestamps[0], timestamps[1]);
+			}
+		}
+
 		vkFreeCommandBuffers(m_device, m_commandPool, 1, &commandBuffer);
 	}
 
 	////////////////////////////////////////////////////////////////////////
 
+	void VulkanRenderer::writeTimestamp(VkCommandBuffer commandBuffer, VkPipelineStageFlagBits stage, uint32_t query)
+	{
+		if (m_timestampQueryPool == VK_NULL_HANDLE)
+		{
+			return;
+		}
+
+		vkCmdWriteTimestamp(commandBuffer, stage, m_timestampQueryPool, query);
+	}
+
+	////////////////////////////////////////////////////////////////////////
+
+	void VulkanRenderer::readFrameTimestamps(uint32_t frame)
+	{
+		if (!m_frameTimestampsPending[frame])
+		{
+			return;
+		}
+		m_frameTimestampsPending[frame] = false;
+
+		std::array<uint64_t, FRAME_TIMESTAMPS_COUNT> timestamps{};
+		VkResult queryResult = vkGetQueryPoolResults(
+			m_device,
+			m_timestampQueryPool,
+			frame * FRAME_TIMESTAMPS_COUNT,
+			FRAME_TIMESTAMPS_COUNT,
+			sizeof(timestamps),
+			timestamps.data(),
+			sizeof(uint64_t),
+			VK_QUERY_RESULT_64_BIT
+		);
+		if (queryResult != VK_SUCCESS)
+		{
+			return;
+		}
+
+		m_frameStats.addGpuFrameTimes(getTimestampsDuration(timestamps[0], timestamps[1]), getTimestampsDuration(timestamps[1], timestamps[2]));
+	}
+
+	////////////////////////////////////////////////////////////////////////
+
+	uint64_t VulkanRenderer::getTimestampsDuration(uint64_t begin, uint64_t end) const
+	{
+		return static_cast<uint64_t>(((end - begin) & m_timestampMask) * (double)m_timestampPeriod);
+	}
+
+	////////////////////////////////////////////////////////////////////////
+
 	VulkanRenderer::QueueFamilyIndices VulkanRenderer::findQueueFamilies(VkPhysicalDevice dev)
 	{
 		QueueFamilyIndices indices;
@@ -1532,6 +1632,13 @@ namespace Engine::Visual
 		vkFreeCommandBuffers(m_device, m_commandPool, static_cast<uint32_t>(m_commandBuffers.size()), m_commandBuffers.data());
 		vkDestroyCommandPool(m_device, m_commandPool, nullptr);
 
+		if (m_timestampQueryPool != VK_NULL_HANDLE)
+		{
+			vkDestroyQueryPool(m_device, m_timestampQueryPool, nullptr);
+			m_timestampQueryPool = VK_NULL_HANDLE;
+		}
+		m_frameTimestampsPending = {};
+
 		vkDestroyDescriptorPool(m_device, m_materialsDescriptorPool, nullptr);
 		vkDestroyDescriptorPool(m_device, m_texturesDescriptorPool, nullptr);
 
@@ -2122,6 +2229,41 @@ namespace Engine::Visual
 
 	////////////////////////////////////////////////////////////////////////
 
+	void VulkanRenderer::createTimestampQueryPool()
+	{
+		VkPhysicalDeviceProperties properties;
+		vkGetPhysicalDeviceProperties(m_physicalDevice, &properties);
+
+		uint32_t queueFamilyCount = 0;
+		vkGetPhysicalDeviceQueueFamilyProperties(m_physicalDevice, &queueFamilyCount, nullptr);
+		std::vector<VkQueueFamilyProperties> queueFamilies(queueFamilyCount);
+		vkGetPhysicalDeviceQueueFamilyProperties(m_physicalDevice, &queueFamilyCount, queueFamilies.data());
+
+		// GPU timings are optional, devices whose graphics queue can't write timestamps just don't report them
+		uint32_t validBits = queueFamilies[findQueueFamilies(m_physicalDevice).graphicsFamily.value()].timestampValidBits;
+		if (validBits == 0 || properties.limits.timestampPeriod == 0.0f)
+		{
+			return;
+		}
+
+		m_timestampPeriod = properties.limits.timestampPeriod;
+		m_timestampMask = validBits >= 64 ? UINT64_MAX : (1ull << validBits) - 1;
+
+		VkQueryPoolCreateInfo queryPoolInfo{};
+		queryPoolInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+		queryPoolInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+		queryPoolInfo.queryCount = TIMESTAMP_QUERIES_COUNT;
+
+		VkResult createQueryPoolResult = vkCreateQueryPool(m_device, &queryPoolInfo, nullptr, &m_timestampQueryPool);
+		if (!validateResult(createQueryPoolResult, "Failed to create timestamp query pool"))
+		{
+			m_timestampQueryPool = VK_NULL_HANDLE;
+			return;
+		}
+	}
+
+	////////////////////////////////////////////////////////////////////////
+
 	void VulkanRenderer::createDescriptorPool()
 	{
 		std::array<VkDescriptorPoolSize, 1> materialPoolSizes{};
@@ -2,6 +2,7 @@
 
 #include <vulkan/vulkan.h>
 #include <glm/glm.hpp>
+#include <array>
 #include <memory>
 #include <string>
 
@@ -29,7 +30,7 @@ namespace Engine::Visual
         void postRenderUI() override;
         void render() override;
 
-        bool loadModel(const std::string& filename) override;
+        bool loadModel(const std::string& filename, const ModelFile& modelFile) override;
         bool loadTexture(const std::string& filename) override;
 
         void setCameraProperties(const Utils::Vector3& position, const Utils::Vector3& rotation) override;
@@ -41,6 +42,7 @@ namespace Engine::Visual
         bool unloadModel(const std::string& filename) override;
 
         void cleanUp() override;
+        RendererFrameStats getFrameStats() const override;
 
     private:
 
@@ -169,6 +171,7 @@ namespace Engine::Visual
         void createDepthResources();
         void createFramebuffers();
         void createDescriptorPool();
+        void createTimestampQueryPool();
 
         VkDescriptorPool createInstancesDescriptorPool();
         EntityID getPoolToUse();
@@ -181,7 +184,7 @@ namespace Engine::Visual
 
 		// Model loading methods
         const TextureData& getTexture(const std::string& textureId) const;
-        bool loadModelFromFile(ModelData& model, const std::string& filename);
+        bool createModelData(ModelData& model, const ModelFile& modelFile);
         bool createBuffersForModel(ModelData& model);
         void unloadMaterial(Material& material);
 
@@ -214,6 +217,11 @@ namespace Engine::Visual
         VkCommandBuffer beginSingleTimeCommands();
         void endSingleTimeCommands(VkCommandBuffer commandBuffer);
 
+        // GPU timing utils
+        void writeTimestamp(VkCommandBuffer commandBuffer, VkPipelineStageFlagBits stage, uint32_t query);
+        void readFrameTimestamps(uint32_t frame);
+        uint64_t getTimestampsDuration(uint64_t begin, uint64_t end) const;
+
         QueueFamilyIndices findQueueFamilies(VkPhysicalDevice dev);
         bool isDeviceSuitable(VkPhysicalDevice dev);
 
@@ -233,6 +241,11 @@ namespace Engine::Visual
         static const int MAX_TEXTURES = 80;
 
         static const int MAX_FRAMES_IN_FLIGHT = 3;
+
+        // queries of a frame slot: frame start, UI pass start, frame end, the uploads get one extra pair
+        static const uint32_t FRAME_TIMESTAMPS_COUNT = 3;
+        static const uint32_t UPLOAD_TIMESTAMPS_OFFSET = MAX_FRAMES_IN_FLIGHT * FRAME_TIMESTAMPS_COUNT;
+        static const uint32_t TIMESTAMP_QUERIES_COUNT = UPLOAD_TIMESTAMPS_OFFSET + 2;
         static inline const std::vector<const char*> DEVICE_EXTENSIONS = { VK_KHR_SWAPCHAIN_EXTENSION_NAME };
 
         VkInstance m_instance{};
@@ -293,5 +306,14 @@ namespace Engine::Visual
         std::unordered_map<std::string, ModelData> m_models;
         std::unordered_map <std::string, TextureData> m_textures;
 
+        VkQueryPool m_timestampQueryPool = VK_NULL_HANDLE;
+        float m_timestampPeriod = 0.0f;
+        uint64_t m_timestampMask = 0;
+        std::array<bool, MAX_FRAMES_IN_FLIGHT> m_frameTimestampsPending{};
+        bool m_uiTimestampWritten = false;
+
+        RendererFrameStats m_frameStats;
+        RendererFrameStats m_lastFrameStats;
+
     };
 }
\ No newline at end of file
@@ -0,0 +1,220 @@
+import argparse
+import mmap
+import os
+import struct
+import sys
+import time
+
+# Mirrors the layout documented in GameEngine/Code/Utils/TelemetryRing.h
+DEFAULT_NAME = "GameEngineTelemetry"
+MAGIC = 0x314D4C54
+VERSION = 1
+
+HEADER = struct.Struct("<IIIIQQ")
+HEADER_SIZE = 64
+RECORD_HEADER = struct.Struct("<QIIQ")
+
+FRAME_RECORD = 1
+STATS_RECORD = 2
+SYSTEM_RECORD = 3
+LOST_RECORD = "lost"
+
+FRAME_PAYLOAD = struct.Struct("<QffQQQ")
+STATS_PAYLOAD = struct.Struct("<10f")
+SYSTEM_PAYLOAD = struct.Struct("<48sffffQQ")
+
+STATS_FIELDS = ["avgFPS", "avgFrameTime", "memoryUsage", "gpuMemoryUsage", "cpuUsage", "gpuUsage",
+                "frameTimePercentile99", "pacingErrorMedian", "pacingErrorPercentile99", "allocationsPerFrame"]
+
+
+def open_windows_mapping(name):
+    # mmap.mmap(tagname=...) creates a missing mapping, which the engine would then find with the wrong size,
+    # so the existing one is opened directly
+    import ctypes
+    from ctypes import wintypes
+
+    class MemoryBasicInformation(ctypes.Structure):
+        _fields_ = [("BaseAddress", ctypes.c_void_p), ("AllocationBase", ctypes.c_void_p), ("AllocationProtect", wintypes.DWORD),
+                    ("PartitionId", wintypes.WORD), ("RegionSize", ctypes.c_size_t), ("State", wintypes.DWORD),
+                    ("Protect", wintypes.DWORD), ("Type", wintypes.DWORD)]
+
+    kernel32 = ctypes.WinDLL("kernel32", use_last_error=True)
+    kernel32.OpenFileMappingW.restype = wintypes.HANDLE
+    kernel32.OpenFileMappingW.argtypes = [wintypes.DWORD, wintypes.BOOL, wintypes.LPCWSTR]
+    kernel32.MapViewOfFile.restype = ctypes.c_void_p
+    kernel32.MapViewOfFile.argtypes = [wintypes.HANDLE, wintypes.DWORD, wintypes.DWORD, wintypes.DWORD, ctypes.c_size_t]
+    kernel32.VirtualQuery.restype = ctypes.c_size_t
+    kernel32.VirtualQuery.argtypes = [ctypes.c_void_p, ctypes.POINTER(MemoryBasicInformation), ctypes.c_size_t]
+    kernel32.CloseHandle.argtypes = [wintypes.HANDLE]
+
+    file_map_read = 0x0004
+    handle = kernel32.OpenFileMappingW(file_map_read, False, "Local\\" + name)
+    if not handle:
+        raise FileNotFoundError(ctypes.get_last_error(), "no telemetry ring named " + name)
+
+    # a view of the whole mapping, its size is only known once it is mapped
+    address = kernel32.MapViewOfFile(handle, file_map_read, 0, 0, 0)
+    error = ctypes.get_last_error()
+    # the view keeps the mapping alive, the handle isn't needed anymore
+    kernel32.CloseHandle(handle)
+    if not address:
+        raise OSError(error, "failed to map the telemetry ring " + name)
+
+    info = MemoryBasicInformation()
+    kernel32.VirtualQuery(address, ctypes.byref(info), ctypes.sizeof(info))
+    # the view stays mapped until the reader exits, slicing it returns bytes like an mmap
+    return (ctypes.c_char * info.RegionSize).from_address(address)
+
+
+def open_ring(name):
+    # fails while the engine hasn't created the ring yet, the caller retries
+    if os.name == "nt":
+        return open_windows_mapping(name)
+
+    with open(os.path.join("/dev/shm", name), "rb") as ring_file:
+        return mmap.mmap(ring_file.fileno(), 0, access=mmap.ACCESS_READ)
+
+
+def read_header(ring):
+    magic, version, record_size, records_count, write_index, start_time = HEADER.unpack_from(ring, 0)
+    if magic != MAGIC or version != VERSION:
+        return None
+    return record_size, records_count, write_index, start_time
+
+
+def read_record(ring, index, record_size, records_count):
+    offset = HEADER_SIZE + (index % records_count) * record_size
+    data = ring[offset:offset + record_size]
+    sequence_after, = struct.unpack_from("<Q", ring, offset)
+    sequence, record_type, _, timestamp = RECORD_HEADER.unpack_from(data, 0)
+    # a record that was already overwritten is lost, one that is still being written is read again later
+    if sequence > index + 1 or sequence_after > index + 1:
+        return LOST_RECORD
+    if sequence != index + 1 or sequence_after != index + 1:
+        return None
+    return record_type, timestamp, data[RECORD_HEADER.size:]
+
+
+def print_record(record_type, timestamp, payload):
+    seconds = timestamp / 1e9
+    if record_type == FRAME_RECORD:
+        frame, frame_time, pacing_error, allocations, draw_calls, triangles = FRAME_PAYLOAD.unpack_from(payload, 0)
+        print(f"{seconds:10.3f} frame {frame}: {1000 * frame_time:.3f} ms, pacing error {1000 * pacing_error:.3f} ms, "
+              f"{allocations} allocations, {draw_calls} draw calls, {triangles} triangles")
+    elif record_type == STATS_RECORD:
+        stats = dict(zip(STATS_FIELDS, STATS_PAYLOAD.unpack_from(payload, 0)))
+        print(f"{seconds:10.3f} stats: " + ", ".join(f"{key} {value:.3f}" for key, value in stats.items()))
+    elif record_type == SYSTEM_RECORD:
+        name, budget, mean_time, percentile99_time, max_time, overruns, updates = SYSTEM_PAYLOAD.unpack_from(payload, 0)
+        name = name.split(b"\0", 1)[0].decode()
+        print(f"{seconds:10.3f} system {name}: mean {1000 * mean_time:.3f} ms, 99th percentile {1000 * percentile99_time:.3f} ms, "
+              f"max {1000 * max_time:.3f} ms, budget {1000 * budget:.3f} ms, {overruns} overruns in {updates} updates")
+
+
+class Aggregator:
+    def __init__(self):
+        self.frame_times = []
+        self.allocations = 0
+        self.draw_calls = 0
+        self.stats = None
+        self.systems = {}
+
+    def add(self, record_type, payload):
+        if record_type == FRAME_RECORD:
+            _, frame_time, _, allocations, draw_calls, _ = FRAME_PAYLOAD.unpack_from(payload, 0)
+            self.frame_times.append(frame_time)
+            self.allocations += allocations
+            self.draw_calls += draw_calls
+        elif record_type == STATS_RECORD:
+            self.stats = dict(zip(STATS_FIELDS, STATS_PAYLOAD.unpack_from(payload, 0)))
+        elif record_type == SYSTEM_RECORD:
+            name, _, mean_time, percentile99_time, _, _, _ = SYSTEM_PAYLOAD.unpack_from(payload, 0)
+            self.systems[name.split(b"\0", 1)[0].decode()] = (mean_time, percentile99_time)
+
+    def flush(self, lost_records):
+        if self.frame_times:
+            frame_times = sorted(self.frame_times)
+            count = len(frame_times)
+            mean = sum(frame_times) / count
+            percentile99 = frame_times[min(count - 1, int(count * 0.99))]
+            print(f"{count} frames: mean {1000 * mean:.3f} ms ({1 / mean:.1f} FPS), median {1000 * frame_times[count // 2]:.3f} ms, "
+                  f"99th percentile {1000 * percentile99:.3f} ms, max {1000 * frame_times[-1]:.3f} ms, "
+                  f"{self.allocations / count:.1f} allocations and {self.draw_calls / count:.1f} draw calls per frame")
+        if self.stats is not None:
+            print(f"    CPU {self.stats['cpuUsage']:.1f}%, GPU {self.stats['gpuUsage']:.1f}%, "
+                  f"RAM {self.stats['memoryUsage']:.1f} MB, VRAM {self.stats['gpuMemoryUsage']:.1f} MB")
+        for name, (mean_time, percentile99_time) in sorted(self.systems.items(), key=lambda item: -item[1][0]):
+            print(f"    {name}: mean {1000 * mean_time:.3f} ms, 99th percentile {1000 * percentile99_time:.3f} ms")
+        if lost_records > 0:
+            print(f"    {lost_records} records were overwritten before they were read")
+        sys.stdout.flush()
+        self.__init__()
+
+
+def tail(name, interval, raw, from_start):
+    ring = None
+    while ring is None:
+        try:
+            ring = open_ring(name)
+        # an object the engine hasn't sized yet can't be mapped
+        except (OSError, ValueError):
+            time.sleep(0.5)
+
+    header = read_header(ring)
+    while header is None:
+        time.sleep(0.1)
+        header = read_header(ring)
+
+    record_size, records_count, write_index, _ = header
+    read_index = max(0, write_index - records_count) if from_start else write_index
+    aggregator = Aggregator()
+    lost_records = 0
+    next_flush = time.monotonic() + interval
+
+    while True:
+        header = read_header(ring)
+        if header is None:
+            time.sleep(0.1)
+            continue
+        write_index = header[2]
+
+        # the engine restarted and reset the ring
+        if write_index < read_index:
+            read_index = 0
+
+        if write_index - read_index > records_count:
+            lost_records += write_index - records_count - read_index
+            read_index = write_index - records_count
+
+        while read_index < write_index:
+            record = read_record(ring, read_index, record_size, records_count)
+            if record is None:
+                break
+            if record is LOST_RECORD:
+                lost_records += 1
+            elif raw:
+                print_record(*record)
+            else:
+                aggregator.add(record[0], record[2])
+            read_index += 1
+
+        if not raw and time.monotonic() >= next_flush:
+            aggregator.flush(lost_records)
+            lost_records = 0
+            next_flush += interval
+
+        time.sleep(0.01)
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Tails the telemetry ring published by GameEngine --telemetry")
+    parser.add_argument("--name", default=DEFAULT_NAME, help="shared memory name of the ring")
+    parser.add_argument("--interval", type=float, default=1.0, help="seconds between aggregated reports")
+    parser.add_argument("--raw", action="store_true", help="print every record instead of aggregating them")
+    parser.add_argument("--from-start", action="store_true", help="also read the records already in the ring")
+    args = parser.parse_args()
+
+    try:
+        tail(args.name, args.interval, args.raw, args.from_start)
+    except KeyboardInterrupt:
+        pass